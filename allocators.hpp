@@ -0,0 +1,298 @@
+#ifndef ALLOCATORS_HPP
+#define ALLOCATORS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+// Политики выделения памяти для Array, Stack и Queue.
+// По умолчанию контейнеры используют std::allocator<T> (обычный operator new).
+
+// Политика автоматического уменьшения буфера контейнера. Буфер растёт вдвое
+// при заполнении и сжимается вдвое, когда size падает ниже capacity / divisor;
+// разрыв между порогами (гистерезис) не даёт буферу "дребезжать" на границе.
+// Поэтому divisor должен быть не меньше 3: при 2 рост и сжатие происходят
+// на соседних размерах, а при 1 буфер сжимался бы меньше size.
+// По умолчанию уменьшение выключено — как и раньше, память не возвращается
+struct ShrinkPolicy {
+    uint32_t divisor = 0;       // 0 — не уменьшать автоматически
+    uint32_t minCapacity = 16;  // Меньше этой вместимости буфер не сжимается
+
+    // Новая вместимость для size элементов (capacity, если сжимать не нужно)
+    [[nodiscard]] auto shrinkTo(size_t size, size_t capacity) const -> size_t {
+        if (divisor == 0) {
+            return capacity;
+        }
+        while (capacity / 2 >= minCapacity && capacity / 2 >= size && size < capacity / divisor) {
+            capacity /= 2;
+        }
+        return capacity;
+    }
+
+    // Проверка при установке политики в контейнер
+    void validate() const {
+        if (divisor == 1 || divisor == 2) {
+            throw std::invalid_argument("ShrinkPolicy: divisor must be 0 (disabled) or at least 3");
+        }
+    }
+
+    // Уменьшение вдвое при заполнении меньше чем на четверть
+    static constexpr auto Quarter() -> ShrinkPolicy {
+        return ShrinkPolicy{4, 16};
+    }
+};
+
+// Вместимость для роста до required элементов: capacity удваивается, пока
+// не станет достаточной. Вместо переполнения size_t и выхода за maxCapacity
+// (max_size() аллокатора) бросается length_error
+inline auto growCapacity(size_t capacity, size_t required, size_t maxCapacity) -> size_t {
+    if (required > maxCapacity) {
+        throw std::length_error("Error: Container size exceeds the allocator's max_size().");
+    }
+    size_t result = capacity == 0 ? 1 : capacity;
+    while (result < required) {
+        result = result > maxCapacity / 2 ? maxCapacity : result * 2;
+    }
+    return result;
+}
+
+// Встроенный буфер на N элементов для контейнеров с малой вместимостью:
+// первые N элементов хранятся прямо в объекте контейнера. При N == 0 буфер
+// пустой и не занимает места (используется с [[no_unique_address]])
+template <typename T, uint32_t N>
+struct InlineBuffer {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+
+    auto get() -> T* {
+        return reinterpret_cast<T*>(bytes);
+    }
+
+    [[nodiscard]] auto contains(const T* ptr) const -> bool {
+        return ptr == reinterpret_cast<const T*>(bytes);
+    }
+};
+
+template <typename T>
+struct InlineBuffer<T, 0> {
+    auto get() -> T* {
+        return nullptr;
+    }
+
+    [[nodiscard]] auto contains(const T*) const -> bool {
+        return false;
+    }
+};
+
+// Арена: память выдаётся сдвигом указателя внутри крупных блоков и
+// освобождается только целиком (в деструкторе или через Reset)
+class Arena {
+ private:
+    struct Block {
+        Block* next;
+        size_t size;
+    };
+
+    Block* blocks;
+    char* cursor;
+    char* limit;
+    char* lastAllocation;  // Последний выданный участок (его можно вернуть)
+    size_t blockSize;
+    size_t bytesUsed;
+
+    void addBlock(size_t minBytes) {
+        size_t size = blockSize;
+        while (size < minBytes + sizeof(Block) + alignof(std::max_align_t)) {
+            size *= 2;
+        }
+        Block* block = static_cast<Block*>(::operator new(size));
+        block->next = blocks;
+        block->size = size;
+        blocks = block;
+        cursor = reinterpret_cast<char*>(block + 1);
+        limit = reinterpret_cast<char*>(block) + size;
+    }
+
+ public:
+    explicit Arena(size_t blockBytes = 1 << 20) : blocks(nullptr)
+                                               , cursor(nullptr)
+                                               , limit(nullptr)
+                                               , lastAllocation(nullptr)
+                                               , blockSize(blockBytes > 64 ? blockBytes : 64)
+                                               , bytesUsed(0) {}
+
+    ~Arena() {
+        Reset();
+    }
+
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+
+    auto Allocate(size_t bytes, size_t alignment) -> void* {
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(alignment - 1);
+        if (cursor == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(limit)) {
+            addBlock(bytes + alignment);
+            aligned = (reinterpret_cast<uintptr_t>(cursor) + alignment - 1) & ~(alignment - 1);
+        }
+        lastAllocation = reinterpret_cast<char*>(aligned);
+        cursor = lastAllocation + bytes;
+        bytesUsed += bytes;
+        return lastAllocation;
+    }
+
+    // Освобождение имеет смысл только для последнего участка: курсор откатывается
+    // (например, временный буфер, выделенный и сразу возвращённый). Остальные
+    // участки остаются занятыми до Reset. Контейнеры при росте выделяют новый
+    // буфер до освобождения старого, поэтому старый уже не последний и каждое
+    // удвоение оставляет предыдущий буфер в арене — суммарно около размера
+    // итогового буфера; для растущих контейнеров заранее задавайте вместимость
+    void Deallocate(void* ptr, size_t bytes) {
+        if (ptr != nullptr && ptr == lastAllocation) {
+            cursor = lastAllocation;
+            lastAllocation = nullptr;
+            bytesUsed -= bytes;
+        }
+    }
+
+    // Освобождение всех блоков арены
+    void Reset() {
+        while (blocks != nullptr) {
+            Block* next = blocks->next;
+            ::operator delete(blocks);
+            blocks = next;
+        }
+        cursor = nullptr;
+        limit = nullptr;
+        lastAllocation = nullptr;
+        bytesUsed = 0;
+    }
+
+    [[nodiscard]] auto GetBytesUsed() const -> size_t {
+        return bytesUsed;
+    }
+};
+
+// Аллокатор поверх арены; копии аллокатора разделяют одну арену
+template <typename T>
+class ArenaAllocator {
+ public:
+    using value_type = T;
+    // Контейнер переносит аллокатор вместе с буфером
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit ArenaAllocator(Arena& owner) noexcept : arena(&owner) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}  // NOLINT
+
+    auto allocate(size_t n) -> T* {
+        return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        arena->Deallocate(ptr, n * sizeof(T));
+    }
+
+    friend auto operator==(const ArenaAllocator& a, const ArenaAllocator& b) noexcept -> bool {
+        return a.arena == b.arena;
+    }
+
+ private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    Arena* arena;
+};
+
+// Аллокатор для очень больших буферов: память берётся через mmap из
+// огромных страниц (MAP_HUGETLB), а если они не зарезервированы в системе —
+// из обычных страниц, выровненных на 2 МБ, с подсказкой madvise(MADV_HUGEPAGE)
+// для прозрачных огромных страниц. Небольшие запросы идут в operator new.
+template <typename T>
+class HugePageAllocator {
+ public:
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    static constexpr size_t hugePageSize = size_t(2) << 20;
+    // Запросы меньше порога не стоят отдельного отображения
+    static constexpr size_t mmapThreshold = hugePageSize / 2;
+
+    HugePageAllocator() noexcept = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) noexcept {}  // NOLINT
+
+    auto allocate(size_t n) -> T* {
+        size_t bytes = n * sizeof(T);
+#ifdef __linux__
+        if (bytes >= mmapThreshold) {
+            return static_cast<T*>(mapHuge(roundUp(bytes)));
+        }
+#endif
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        size_t bytes = n * sizeof(T);
+#ifdef __linux__
+        if (bytes >= mmapThreshold) {
+            munmap(ptr, roundUp(bytes));
+            return;
+        }
+#endif
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    friend auto operator==(const HugePageAllocator&, const HugePageAllocator&) noexcept -> bool {
+        return true;
+    }
+
+ private:
+    static auto roundUp(size_t bytes) -> size_t {
+        return (bytes + hugePageSize - 1) & ~(hugePageSize - 1);
+    }
+
+#ifdef __linux__
+    static auto mapHuge(size_t bytes) -> void* {
+        void* ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != MAP_FAILED) {
+            return ptr;
+        }
+
+        // Пул огромных страниц недоступен: выравниваем обычное отображение на 2 МБ,
+        // чтобы ядро могло собрать его из прозрачных огромных страниц
+        size_t padded = bytes + hugePageSize;
+        char* raw = static_cast<char*>(mmap(nullptr, padded, PROT_READ | PROT_WRITE,
+                                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + hugePageSize - 1) & ~(hugePageSize - 1);
+        char* start = reinterpret_cast<char*>(aligned);
+        if (start > raw) {
+            munmap(raw, start - raw);
+        }
+        size_t tail = (raw + padded) - (start + bytes);
+        if (tail > 0) {
+            munmap(start + bytes, tail);
+        }
+        madvise(start, bytes, MADV_HUGEPAGE);
+        return start;
+    }
+#endif
+};
+
+#endif  // ALLOCATORS_HPP
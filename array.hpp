@@ -3,108 +3,418 @@
 
 #include <iostream>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <vector>
+#include <memory>
+#include <new>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <span>
 #include <stdexcept> 
+#include "array_codec.hpp"
+#include "array_simd.hpp"
+#include "array_sort.hpp"
+#include "allocators.hpp"
+#include "binary_format.hpp"
+#include "text_codec.hpp"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
-template <typename T>
+// Режим отображения файла в память для Array::MMAP_BINARY
+enum class MapMode {
+    ReadOnly,     // Только чтение: запись в элементы недопустима
+    CopyOnWrite,  // Изменённые страницы копируются и в файл не попадают
+};
+
+// Alloc — политика выделения памяти (см. allocators.hpp).
+// InlineCapacity — сколько элементов хранится прямо в объекте: пока они
+// помещаются, массив не обращается к аллокатору
+template <typename T, typename Alloc = allocator<T>, uint32_t InlineCapacity = 0>
 class Array {
  private:
-    T* data;
-    uint32_t capacity;
-    uint32_t size;
+    using AllocTraits = allocator_traits<Alloc>;
+    // Перемещение встроенных элементов поштучное, поэтому noexcept зависит от T
+    static constexpr bool nothrowMove = InlineCapacity == 0 || is_nothrow_move_constructible_v<T>;
+
+    [[no_unique_address]] Alloc alloc;
+    [[no_unique_address]] InlineBuffer<T, InlineCapacity> inlineStorage;
+    T* buffer;
+    size_t capacity;
+    size_t size;
+    // Отображение файла, если buffer указывает в него (см. MMAP_BINARY)
+    void* mapping = nullptr;
+    size_t mappingBytes = 0;
+    bool mappingReadOnly = false;  // Отображение с PROT_READ (MapMode::ReadOnly)
+    ShrinkPolicy shrinkPolicy;  // По умолчанию буфер не уменьшается
+
+    // Выделение "сырой" памяти без конструирования элементов
+    auto allocate(size_t cap) -> T* {
+        return AllocTraits::allocate(alloc, cap);
+    }
 
-    void doubleArray() {  // Удвоение массива при достижении лимита capacity
-        uint32_t cap = capacity;
-        T* newData = new T[cap * 2];
-        capacity = cap * 2;
-        for (uint32_t i = 0; i < size; i++) {
-            newData[i] = data[i];
+    void deallocate(T* ptr, size_t cap) {
+        if (ptr != nullptr && !inlineStorage.contains(ptr)) {
+            AllocTraits::deallocate(alloc, ptr, cap);
         }
-        delete[] data;
-        data = newData;
     }
 
- public:
-    Array() : size(0)  // Конструктор для пустого массива
-            , capacity(1)
-            , data(new T[1]) {}
+    // Буфер вместимостью не меньше cap: встроенный, если элементы в нём
+    // помещаются, иначе из аллокатора. В cap записывается фактическая вместимость
+    auto obtain(size_t& cap) -> T* {
+        if (InlineCapacity > 0 && cap <= InlineCapacity) {
+            cap = InlineCapacity;
+            return inlineStorage.get();
+        }
+        return allocate(cap);
+    }
+
+    [[nodiscard]] auto isInline() const -> bool {
+        return inlineStorage.contains(buffer);
+    }
+
+    // Состояние после передачи буфера другому массиву: пустой встроенный
+    // буфер или отсутствие буфера при InlineCapacity == 0
+    void resetStorage() {
+        buffer = inlineStorage.get();
+        capacity = InlineCapacity;
+        size = 0;
+    }
+
+    // Освобождение текущего буфера: отображённый файл снимается munmap,
+    // обычная память возвращается аллокатору
+    void releaseBuffer() {
+        if (mapping != nullptr) {
+#ifdef __linux__
+            munmap(mapping, mappingBytes);
+#endif
+            mapping = nullptr;
+            mappingBytes = 0;
+            mappingReadOnly = false;
+        } else {
+            deallocate(buffer, capacity);
+        }
+    }
+
+    // Перед изменением элементов на месте: отображение только для чтения
+    // копируется в память аллокатора, иначе запись упала бы с SIGSEGV
+    void makeWritable() {
+        if (mapping != nullptr && mappingReadOnly) {
+            reallocate(capacity > 0 ? capacity : 1);
+        }
+    }
+
+    // Замена текущего буфера пустым буфером аллокатора вместимостью не меньше
+    // required (элементы уже уничтожены); нужна перед загрузкой поверх отображения
+    void resetBuffer(size_t required) {
+        releaseBuffer();
+        buffer = nullptr;
+        capacity = 0;
+        size_t cap = required > 0 ? required : 1;
+        buffer = obtain(cap);
+        capacity = cap;
+    }
+
+    // Перенос count элементов в неинициализированную память to.
+    // Тривиально копируемые типы переносятся одним memcpy, остальные перемещаются
+    static void relocate(T* from, T* to, size_t count) {
+        if constexpr (is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                new (to + i) T(std::move_if_noexcept(from[i]));
+                from[i].~T();
+            }
+        }
+    }
 
-    explicit Array(const uint32_t cap) : size(cap - 1)  // Конструктор
-                                , capacity(cap)
-                                , data(new T[cap]) {
-        for (uint32_t i = 0; i < cap; i++) {
-            data[i] = T();
+    // Вызов деструкторов для элементов [from, to)
+    void destroyElements(size_t from, size_t to) {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (size_t i = from; i < to; i++) {
+                buffer[i].~T();
+            }
         }
     }
 
+    // Перенос элементов в новый буфер вместимостью newCapacity
+    void reallocate(size_t newCapacity) {
+        if (isInline() && newCapacity <= InlineCapacity) {
+            return;
+        }
+        T* newData = obtain(newCapacity);
+        relocate(buffer, newData, size);
+        releaseBuffer();
+        buffer = newData;
+        capacity = newCapacity;
+    }
+
+    // Удаление [first, last) без проверки границ
+    void eraseRange(size_t first, size_t last) {
+        if (first == last) {
+            return;
+        }
+        makeWritable();
+        if constexpr (is_trivially_copyable_v<T>) {
+            memmove(static_cast<void*>(buffer + first), static_cast<const void*>(buffer + last),
+                    (size - last) * sizeof(T));
+        } else {
+            std::move(buffer + last, buffer + size, buffer + first);
+            destroyElements(size - (last - first), size);
+        }
+        size -= last - first;
+        shrinkIfNeeded();
+    }
+
+    // Уменьшение буфера по политике после удаления элементов
+    void shrinkIfNeeded() {
+        size_t newCapacity = shrinkPolicy.shrinkTo(size, capacity);
+        if (newCapacity < capacity && mapping == nullptr) {
+            reallocate(newCapacity);
+        }
+    }
+
+    void doubleArray() {  // Удвоение массива при достижении лимита capacity
+        reallocate(growCapacity(capacity, size + 1, AllocTraits::max_size(alloc)));
+    }
+
+ public:
+    Array() : Array(Alloc()) {}  // Конструктор для пустого массива
+
+    // Конструктор пустого массива с заданным аллокатором
+    explicit Array(const Alloc& allocator) : alloc(allocator)
+                                           , buffer(nullptr)
+                                           , capacity(1)
+                                           , size(0) {
+        buffer = obtain(capacity);
+    }
+
+    // Конструктор: первые cap - 1 элементов инициализируются значением T()
+    explicit Array(const size_t cap, const Alloc& allocator = Alloc()) : alloc(allocator)
+                                , buffer(nullptr)
+                                , capacity(cap > 0 ? cap : 1)
+                                , size(cap > 0 ? cap - 1 : 0) {
+        buffer = obtain(capacity);
+        uninitialized_value_construct_n(buffer, size);
+    }
+
     ~Array() {  // Деструктор
-        delete[] data;
+        destroyElements(0, size);
+        releaseBuffer();
+    }
+
+    Array(const Array& other)  // Копирующий конструктор
+        : alloc(AllocTraits::select_on_container_copy_construction(other.alloc))
+        , buffer(nullptr)
+        , capacity(other.capacity)
+        , size(other.size) {
+        buffer = obtain(capacity);
+        uninitialized_copy(other.buffer, other.buffer + size, buffer);
+        shrinkPolicy = other.shrinkPolicy;
     }
 
-    Array(const Array<T>& other) : size(other.size)  // Копирующий конструктор
+    // Перемещающий конструктор: забирает буфер other без копирования
+    // (элементы из встроенного буфера other переносятся поштучно)
+    Array(Array&& other) noexcept(nothrowMove) : alloc(other.alloc)
+                                    , buffer(other.buffer)
                                     , capacity(other.capacity)
-                                    , data(new T[other.capacity]) {
-        for (uint32_t i = 0; i < size; i++) {
-            data[i] = other.data[i];
+                                    , size(other.size)
+                                    , mapping(other.mapping)
+                                    , mappingBytes(other.mappingBytes)
+                                    , mappingReadOnly(other.mappingReadOnly) {
+        if (other.isInline()) {
+            buffer = inlineStorage.get();
+            relocate(other.buffer, buffer, size);
         }
+        shrinkPolicy = other.shrinkPolicy;
+        other.mapping = nullptr;
+        other.mappingBytes = 0;
+        other.mappingReadOnly = false;
+        other.resetStorage();
     }
 
     // Копирующий оператор присваивания
-    auto operator=(const Array<T>& other) -> Array<T>& {
+    auto operator=(const Array& other) -> Array& {
         if (this == &other) {  // Защита от a = a
             return *this;
         }
-        delete[] data;
+        destroyElements(0, size);
+        size = 0;
+        constexpr bool propagate = AllocTraits::propagate_on_container_copy_assignment::value;
+        // Отображённый файл не перезаписывается: копия всегда уходит в новый буфер
+        if (capacity != other.capacity || mapping != nullptr || (propagate && !(alloc == other.alloc))) {
+            releaseBuffer();
+            buffer = nullptr;
+            capacity = 0;
+            if constexpr (propagate) {
+                alloc = other.alloc;
+            }
+            size_t cap = other.capacity;
+            buffer = obtain(cap);
+            capacity = cap;
+        }
+        uninitialized_copy(other.buffer, other.buffer + other.size, buffer);
+        size = other.size;
+        shrinkPolicy = other.shrinkPolicy;
+        return *this;
+    }
 
+    // Перемещающий оператор присваивания
+    auto operator=(Array&& other) noexcept(nothrowMove) -> Array& {
+        if (this == &other) {
+            return *this;
+        }
+        destroyElements(0, size);
+        releaseBuffer();
+
+        // Буфер other освобождается его аллокатором, поэтому аллокатор переходит вместе с ним
+        alloc = other.alloc;
+        buffer = other.buffer;
         capacity = other.capacity;
         size = other.size;
-        data = new T[capacity];
-        for (uint32_t i = 0; i < size; i++) {
-            data[i] = other.data[i];
+        mapping = other.mapping;
+        mappingBytes = other.mappingBytes;
+        if (other.isInline()) {
+            buffer = inlineStorage.get();
+            relocate(other.buffer, buffer, size);
         }
+        mappingReadOnly = other.mappingReadOnly;
+        shrinkPolicy = other.shrinkPolicy;
+        other.mapping = nullptr;
+        other.mappingBytes = 0;
+        other.mappingReadOnly = false;
+        other.resetStorage();
         return *this;
     }
 
+    // Обмен содержимым за O(1): меняются только указатели и счётчики
+    void swap(Array& other) noexcept(nothrowMove) {
+        if (isInline() || other.isInline()) {
+            // Встроенные буферы не обмениваются указателями
+            Array tmp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(tmp);
+            return;
+        }
+        if constexpr (AllocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc, other.alloc);
+        }
+        std::swap(buffer, other.buffer);
+        std::swap(capacity, other.capacity);
+        std::swap(size, other.size);
+        std::swap(mapping, other.mapping);
+        std::swap(mappingBytes, other.mappingBytes);
+        std::swap(mappingReadOnly, other.mappingReadOnly);
+        std::swap(shrinkPolicy, other.shrinkPolicy);
+    }
+
+    friend void swap(Array& a, Array& b) noexcept(nothrowMove) {
+        a.swap(b);
+    }
+
+    // Итераторы — обычные указатели, поэтому range-for и алгоритмы std
+    // компилируются в простые циклы без проверок границ
+    auto begin() -> T* {
+        return buffer;
+    }
+
+    auto end() -> T* {
+        return buffer + size;
+    }
+
+    auto begin() const -> const T* {
+        return buffer;
+    }
+
+    auto end() const -> const T* {
+        return buffer + size;
+    }
+
+    // Прямой доступ к непрерывному буферу элементов
+    auto data() -> T* {
+        return buffer;
+    }
+
+    auto data() const -> const T* {
+        return buffer;
+    }
+
+    // Представление элементов [0, size) в виде std::span
+    auto span() -> std::span<T> {
+        return std::span<T>(buffer, size);
+    }
+
+    auto span() const -> std::span<const T> {
+        return std::span<const T>(buffer, size);
+    }
+
+    // Доступ по индексу без проверки границ (индекс должен быть меньше size)
+    auto MGET_UNCHECKED(size_t index) -> T& {
+        return buffer[index];
+    }
+
+    auto MGET_UNCHECKED(size_t index) const -> const T& {
+        return buffer[index];
+    }
+
     // Неконстантная перегрузка оператора скобок
-    auto operator[](uint32_t index) -> T& {
+    auto operator[](size_t index) -> T& {
         if (index >= size) {
             throw out_of_range("Error: Index " + to_string(index) 
             + " is out of bounds (size " + to_string(size) + ").");
         }
-        return data[index];
+        return buffer[index];
     }
 
     // Константная перегрузка оператора скобок (для чтения)
-    auto operator[](uint32_t index) const -> const T& {
+    auto operator[](size_t index) const -> const T& {
     if (index >= size) {
         throw out_of_range("Error: Index " + to_string(index) 
         + " is out of bounds (size " + to_string(size) + ").");
     }
-    return data[index];
+    return buffer[index];
 }
 
     void MPUSH_BACK(T value) {  // Добавление элемента в конец массива
         if (size + 1 > capacity) {
             doubleArray();
         }
-        data[size] = value;
+        new (buffer + size) T(std::move(value));
         size++;
     }
 
     // Добавление элемента по индексу
-    void MPUSH_BY_IND(uint32_t index, T value) {
+    void MPUSH_BY_IND(size_t index, T value) {
         if (size + 1 > capacity) {
             doubleArray();
         }
         if (index <= size) {
-            for (uint32_t j = size; j > index; j--) {
-                data[j] = data[j - 1];
+            if constexpr (is_trivially_copyable_v<T>) {
+                // Хвост сдвигается одним memmove
+                memmove(static_cast<void*>(buffer + index + 1), static_cast<const void*>(buffer + index),
+                        (size - index) * sizeof(T));
+                new (buffer + index) T(std::move(value));
+            } else if (index == size) {
+                new (buffer + size) T(std::move(value));
+            } else {
+                // Последний элемент переезжает в неинициализированную ячейку,
+                // остальные сдвигаются перемещением
+                new (buffer + size) T(std::move(buffer[size - 1]));
+                move_backward(buffer + index, buffer + size - 1, buffer + size);
+                buffer[index] = std::move(value);
             }
-            data[index] = value;
             size++;
         } else {
             throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for insertion.");
@@ -112,69 +422,220 @@ class Array {
     }
 
     // Получение элемента по индексу
-    auto MGET_BY_IND(uint32_t index) const -> T& {
+    auto MGET_BY_IND(size_t index) const -> T& {
         if (index < size) {
-            return data[index];
+            return buffer[index];
         } else {
             throw out_of_range("Error: Index " + to_string(index) + " is out of bounds.");
         }
     }
 
-    void MDEL_BY_IND(uint32_t index) {
+    void MDEL_BY_IND(size_t index) {
         if (index < size) {
-            for (uint32_t i = index; i < size - 1; i++) {
-                data[i] = data[i + 1];
-            }
-            size--;
+            eraseRange(index, index + 1);
         } else {
             throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for deletion.");
         }
     }
 
-    void MSWAP_BY_IND(uint32_t index, T value) {
+    // Вставка count элементов из values начиная с индекса index.
+    // Хвост сдвигается один раз, а не count раз, как при серии MPUSH_BY_IND
+    void MPUSH_RANGE_BY_IND(size_t index, const T* values, size_t count) {
+        if (index > size) {
+            throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for insertion.");
+        }
+        if (count == 0) {
+            return;
+        }
+        size_t newSize = size + count;
+
+        if (newSize > capacity) {
+            // Собираем новый буфер: префикс, вставка, хвост.
+            // Старый буфер ещё жив, поэтому values может указывать внутрь массива
+            size_t newCapacity = growCapacity(capacity, newSize, AllocTraits::max_size(alloc));
+            T* newData = allocate(newCapacity);
+            try {
+                uninitialized_copy(values, values + count, newData + index);
+            } catch (...) {
+                deallocate(newData, newCapacity);
+                throw;
+            }
+            relocate(buffer, newData, index);
+            relocate(buffer + index, newData + index + count, size - index);
+            releaseBuffer();
+            buffer = newData;
+            capacity = newCapacity;
+            size = newSize;
+            return;
+        }
+
+        // Источник внутри массива будет затронут сдвигом — вставляем из копии
+        if (!less<const T*>()(values, buffer) && less<const T*>()(values, buffer + size)) {
+            Array copy(alloc);
+            copy.MPUSH_RANGE_BY_IND(0, values, count);
+            MPUSH_RANGE_BY_IND(index, copy.buffer, count);
+            return;
+        }
+
+        size_t tail = size - index;
+        if constexpr (is_trivially_copyable_v<T>) {
+            memmove(static_cast<void*>(buffer + index + count), static_cast<const void*>(buffer + index),
+                    tail * sizeof(T));
+            memcpy(static_cast<void*>(buffer + index), static_cast<const void*>(values), count * sizeof(T));
+        } else if (tail > count) {
+            // Последние count элементов хвоста уходят в неинициализированную область,
+            // остальная часть хвоста сдвигается перемещением
+            uninitialized_move(buffer + size - count, buffer + size, buffer + size);
+            move_backward(buffer + index, buffer + size - count, buffer + size);
+            copy(values, values + count, buffer + index);
+        } else {
+            // Хвост целиком уходит в неинициализированную область
+            uninitialized_copy(values + tail, values + count, buffer + size);
+            uninitialized_move(buffer + index, buffer + size, buffer + index + count);
+            copy(values, values + tail, buffer + index);
+        }
+        size = newSize;
+    }
+
+    // Удаление элементов в диапазоне [first, last) с одним сдвигом хвоста
+    void MDEL_RANGE(size_t first, size_t last) {
+        if (first > last || last > size) {
+            throw out_of_range("Error: Range [" + to_string(first) + ", " + to_string(last)
+            + ") is out of bounds for deletion (size " + to_string(size) + ").");
+        }
+        eraseRange(first, last);
+    }
+
+    void MSWAP_BY_IND(size_t index, T value) {
         if (index < size) {
-            data[index] = value;
+            makeWritable();
+            buffer[index] = std::move(value);
         } else {
             throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for swap.");
         }
     }
 
+    // Поиск первого вхождения value: индекс элемента или GetSize(), если его нет.
+    // Для int32_t/uint32_t используются векторные ядра (AVX2/SSE4.1)
+    auto MFIND(const T& value) const -> size_t {
+        return array_simd::find(buffer, size, value);
+    }
+
+    // Количество элементов, равных value
+    auto MCOUNT(const T& value) const -> size_t {
+        return array_simd::count(buffer, size, value);
+    }
+
+    // Минимальный элемент массива
+    auto MMIN() const -> T {
+        if (size == 0) {
+            throw out_of_range("Error: Cannot take minimum of an empty array.");
+        }
+        return array_simd::min(buffer, size);
+    }
+
+    // Максимальный элемент массива
+    auto MMAX() const -> T {
+        if (size == 0) {
+            throw out_of_range("Error: Cannot take maximum of an empty array.");
+        }
+        return array_simd::max(buffer, size);
+    }
+
+    // Сумма элементов (для целых типов накапливается в 64 битах)
+    auto MSUM() const -> array_simd::SumType<T> {
+        return array_simd::sum(buffer, size);
+    }
+
+    // Новый массив из элементов, для которых pred(element) == true
+    template <typename Pred>
+    auto MFILTER(Pred pred) const -> Array {
+        Array result(alloc);
+        for (size_t i = 0; i < size; i++) {
+            if (pred(buffer[i])) {
+                result.MPUSH_BACK(buffer[i]);
+            }
+        }
+        return result;
+    }
+
+    // Новый массив из элементов, попадающих в отрезок [lo, hi]
+    auto MFILTER_RANGE(const T& lo, const T& hi) const -> Array {
+        if constexpr (array_simd::hasKernels<T>) {
+            // Векторное ядро пишет целыми регистрами, поэтому нужен запас ёмкости
+            Array result(alloc);
+            result.reallocate(size + array_simd::filterSlack);
+            result.size = array_simd::filterRange(buffer, size, lo, hi, result.buffer);
+            return result;
+        } else {
+            return MFILTER([&lo, &hi](const T& value) { return !(value < lo) && !(hi < value); });
+        }
+    }
+
+    // Сортировка по возрастанию параллельным слиянием на threads потоках
+    // (0 — по числу аппаратных потоков)
+    void MSORT(uint32_t threads = 0) {
+        makeWritable();
+        array_sort::parallelMergeSort(buffer, size, less<T>(), threads);
+    }
+
+    // Сортировка с пользовательским компаратором
+    template <typename Compare>
+    void MSORT_BY(Compare comp, uint32_t threads = 0) {
+        makeWritable();
+        array_sort::parallelMergeSort(buffer, size, comp, threads);
+    }
+
+    // Поразрядная (LSD) сортировка по возрастанию для целочисленных элементов
+    void MRADIX_SORT() {
+        makeWritable();
+        array_sort::radixSort(buffer, size);
+    }
+
     void PRINT() const {
-        for (uint32_t i = 0; i < size; i++) {
-            cout << data[i] << " ";
+        for (size_t i = 0; i < size; i++) {
+            cout << buffer[i] << " ";
         }
         cout << endl;
     }
 
     // Сохранение массива в файл
     void MSAVE(const string& filename) const {
-        ofstream file(filename);
+        text_codec::Writer file(filename);
         if (!file.is_open()) {
             throw runtime_error("Error: Unable to open file for writing: " + filename);
         }
-        file << size << endl;
-        for (uint32_t i = 0; i < size; i++) {
-            file << data[i] << " ";
+        file.write(size);
+        file.put('\n');
+        for (size_t i = 0; i < size; i++) {
+            file.write(buffer[i]);
+            file.put(' ');
+        }
+        if (!file.close()) {
+            throw runtime_error("Error: Write operation failed for file: " + filename);
         }
-        file.close();
         cout << "Массив сохранён в файл: " << filename << endl;
     }
 
     // Загрузка массива из файла
     void MLOAD(const string& filename) {
-        ifstream file(filename);
+        text_codec::Reader file(filename);
         if (!file.is_open()) {
             throw runtime_error("Error: Unable to open file for reading: " + filename);
         }
-        uint32_t NewSize;
-        if (!(file >> NewSize)) {
+        size_t NewSize;
+        if (!file.read(NewSize)) {
              throw runtime_error("Error: Failed to read size from file: " + filename);
         }
         
+        destroyElements(0, size);
         size = 0;
+        if (mapping != nullptr) {
+            resetBuffer(NewSize < capacity ? NewSize : capacity);
+        }
         T value;
-        while (size < NewSize && file >> value) {
-            MPUSH_BACK(value);
+        while (size < NewSize && file.read(value)) {
+            MPUSH_BACK(std::move(value));
         }
 
         if (size != NewSize) {
@@ -187,16 +648,17 @@ class Array {
 
     // Сохранение массива в бинарный файл
     void MSAVE_BINARY(const string& filename) const {
+        static_assert(is_trivially_copyable_v<T>, "MSAVE_BINARY requires a trivially copyable T");
         ofstream file(filename, ios::binary);
         if (!file.is_open()) {
             throw runtime_error("Error: Unable to open file for binary writing: " + filename);
         }
 
-        // Записываем размер массива
-        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        // Записываем заголовок с 64-битным размером массива
+        binary_format::writeHeader(file, size);
 
         if (size > 0) {
-            file.write(reinterpret_cast<const char*>(data), size * sizeof(T));
+            file.write(reinterpret_cast<const char*>(buffer), size * sizeof(T));
         }
         
         if (!file) {
@@ -209,30 +671,32 @@ class Array {
 
     // Загрузка массива из бинарного файла
     void MLOAD_BINARY(const string& filename) {
+        static_assert(is_trivially_copyable_v<T>, "MLOAD_BINARY requires a trivially copyable T");
         ifstream file(filename, ios::binary);
         if (!file.is_open()) {
              throw runtime_error("Error: Unable to open file for binary reading: " + filename);
         }
 
-        uint32_t newSize = 0;
-        // Читаем размер массива
-        file.read(reinterpret_cast<char*>(&newSize), sizeof(newSize));
-
-        if (!file) { 
+        uint64_t newSize = 0;
+        // Читаем размер массива (понимает и старый 32-битный заголовок)
+        if (!binary_format::readHeader(file, newSize)) {
             throw runtime_error("Error: Failed to read size from binary file.");
         }
+        if (newSize > AllocTraits::max_size(alloc)) {
+            throw length_error("Error: Array size in binary file exceeds max_size().");
+        }
 
         // Подготовка памяти
-        if (newSize > capacity) {
-            delete[] data;
-            capacity = newSize; 
-            data = new T[capacity];
+        destroyElements(0, size);
+        size = 0;
+        if (newSize > capacity || mapping != nullptr) {
+            resetBuffer(newSize);
         }
         size = newSize;
 
         // Читаем данные прямо в массив
         if (size > 0) {
-            file.read(reinterpret_cast<char*>(data), size * sizeof(T));
+            file.read(reinterpret_cast<char*>(buffer), size * sizeof(T));
             if (!file) {
                  throw runtime_error("Error: Failed to read data from binary file (incomplete file).");
             }
@@ -242,27 +706,225 @@ class Array {
         cout << "Массив (бинарный) загружен из файла: " << filename << endl;
     }
 
-    [[nodiscard]] auto GetSize() const -> uint32_t {
+    // Сохранение целочисленного массива в сжатый бинарный файл (см. array_codec.hpp).
+    // После заголовка: uint32 кодек, uint32 sizeof(T), uint64 длина сжатых данных
+    void MSAVE_COMPRESSED(const string& filename) const {
+        static_assert(is_integral_v<T> && !is_same_v<T, bool>, "MSAVE_COMPRESSED requires an integer T");
+        ofstream file(filename, ios::binary);
+        if (!file.is_open()) {
+            throw runtime_error("Error: Unable to open file for binary writing: " + filename);
+        }
+
+        uint32_t codec = static_cast<uint32_t>(array_codec::codecFor<T>);
+        uint32_t elementBytes = sizeof(T);
+        uint64_t payloadBytes = 0;  // Дописывается после сжатия
+        binary_format::writeHeader(file, size, binary_format::compressedVersion);
+        file.write(reinterpret_cast<const char*>(&codec), sizeof(codec));
+        file.write(reinterpret_cast<const char*>(&elementBytes), sizeof(elementBytes));
+        streampos payloadBytesPos = file.tellp();
+        file.write(reinterpret_cast<const char*>(&payloadBytes), sizeof(payloadBytes));
+
+        // Массив сжимается по частям, чтобы не держать в памяти всё сжатое представление
+        vector<uint8_t> chunk;
+        for (size_t first = 0; first < size; first += array_codec::chunkValues) {
+            size_t last = size - first < array_codec::chunkValues ? size : first + array_codec::chunkValues;
+            chunk.clear();
+            array_codec::encode(buffer, first, last, chunk);
+            file.write(reinterpret_cast<const char*>(chunk.data()), static_cast<streamsize>(chunk.size()));
+            payloadBytes += chunk.size();
+        }
+        file.seekp(payloadBytesPos);
+        file.write(reinterpret_cast<const char*>(&payloadBytes), sizeof(payloadBytes));
+
+        if (!file) {
+             throw runtime_error("Error: Write operation failed for file: " + filename);
+        }
+        file.close();
+        cout << "Массив (сжатый) сохранён в файл: " << filename << endl;
+    }
+
+    // Загрузка массива, сохранённого MSAVE_COMPRESSED с тем же типом элементов
+    void MLOAD_COMPRESSED(const string& filename) {
+        static_assert(is_integral_v<T> && !is_same_v<T, bool>, "MLOAD_COMPRESSED requires an integer T");
+        ifstream file(filename, ios::binary);
+        if (!file.is_open()) {
+             throw runtime_error("Error: Unable to open file for binary reading: " + filename);
+        }
+
+        uint64_t newSize = 0;
+        uint32_t codec = 0;
+        uint32_t elementBytes = 0;
+        uint64_t payloadBytes = 0;
+        if (!binary_format::readHeader(file, newSize, binary_format::compressedVersion)
+            || !file.read(reinterpret_cast<char*>(&codec), sizeof(codec))
+            || !file.read(reinterpret_cast<char*>(&elementBytes), sizeof(elementBytes))
+            || !file.read(reinterpret_cast<char*>(&payloadBytes), sizeof(payloadBytes))) {
+            throw runtime_error("Error: Failed to read compressed header from file: " + filename);
+        }
+        if (codec != static_cast<uint32_t>(array_codec::codecFor<T>) || elementBytes != sizeof(T)) {
+            throw runtime_error("Error: Compressed file was written for a different element type.");
+        }
+        if (newSize > AllocTraits::max_size(alloc)) {
+            throw length_error("Error: Array size in compressed file exceeds max_size().");
+        }
+
+        destroyElements(0, size);
+        size = 0;
+        if (newSize > capacity || mapping != nullptr) {
+            resetBuffer(newSize);
+        }
+        // Сжатые данные читаются кусками и распаковываются прямо в буфер массива
+        vector<uint8_t> chunk(array_codec::chunkBytes);
+        array_codec::DecodeState state;
+        size_t filled = 0;
+        size_t decoded = 0;
+        while (decoded < newSize) {
+            size_t want = static_cast<size_t>(min<uint64_t>(chunk.size() - filled, payloadBytes));
+            if (!file.read(reinterpret_cast<char*>(chunk.data() + filled), static_cast<streamsize>(want))) {
+                throw runtime_error("Error: Failed to read data from compressed file (incomplete file).");
+            }
+            filled += want;
+            payloadBytes -= want;
+            size_t consumed = 0;
+            decoded += array_codec::decode(chunk.data(), filled, buffer + decoded, newSize - decoded, state, consumed);
+            if (state.corrupt || (consumed == 0 && payloadBytes == 0)) {
+                throw runtime_error("Error: Compressed data is corrupted: " + filename);
+            }
+            memmove(chunk.data(), chunk.data() + consumed, filled - consumed);
+            filled -= consumed;
+        }
+        size = newSize;
+
+        file.close();
+        cout << "Массив (сжатый) загружен из файла: " << filename << endl;
+    }
+
+    // Открытие файла, записанного MSAVE_BINARY, как представления без копирования:
+    // элементы читаются прямо из страничного кэша. В режиме ReadOnly запись
+    // через ссылки на элементы (operator[], data(), итераторы) недопустима, а
+    // изменяющие методы (MDEL_*, MSWAP_BY_IND, MSORT, SetSize) сначала копируют
+    // элементы в память аллокатора; в режиме CopyOnWrite изменения остаются
+    // в памяти процесса.
+    // Рост массива переносит элементы в обычный буфер аллокатора.
+    // populate = true заранее подгружает все страницы (MAP_POPULATE),
+    // иначе страницы подгружаются по первому обращению
+    void MMAP_BINARY(const string& filename, MapMode mode = MapMode::ReadOnly, bool populate = false) {
+        static_assert(is_trivially_copyable_v<T>, "MMAP_BINARY requires a trivially copyable T");
+#ifdef __linux__
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw runtime_error("Error: Unable to open file for mapping: " + filename);
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < binary_format::legacyHeaderBytes) {
+            close(fd);
+            throw runtime_error("Error: Failed to read size from binary file.");
+        }
+        size_t fileBytes = static_cast<size_t>(st.st_size);
+
+        int prot = mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+        int flags = MAP_PRIVATE | (populate ? MAP_POPULATE : 0);
+        void* view = mmap(nullptr, fileBytes, prot, flags, fd, 0);
+        close(fd);  // Отображение остаётся действительным после закрытия файла
+        if (view == MAP_FAILED) {
+            throw runtime_error("Error: Unable to map file: " + filename);
+        }
+
+        uint64_t newSize = 0;
+        size_t headerBytes = binary_format::parseHeader(static_cast<const char*>(view), fileBytes, newSize);
+        char* elements = static_cast<char*>(view) + headerBytes;
+        if (headerBytes == 0 || (fileBytes - headerBytes) / sizeof(T) < newSize) {
+            munmap(view, fileBytes);
+            throw runtime_error("Error: Failed to read data from binary file (incomplete file).");
+        }
+        if (reinterpret_cast<uintptr_t>(elements) % alignof(T) != 0) {
+            munmap(view, fileBytes);
+            throw runtime_error("Error: Element alignment does not allow mapping, use MLOAD_BINARY.");
+        }
+
+        destroyElements(0, size);
+        releaseBuffer();
+        mapping = view;
+        mappingBytes = fileBytes;
+        mappingReadOnly = mode == MapMode::ReadOnly;
+        buffer = reinterpret_cast<T*>(elements);
+        size = newSize;
+        capacity = newSize;
+        cout << "Массив (бинарный) отображён из файла: " << filename << endl;
+#else
+        (void)mode;
+        (void)populate;
+        MLOAD_BINARY(filename);
+#endif
+    }
+
+    // true, если элементы находятся в отображённом файле
+    [[nodiscard]] auto IsMapped() const -> bool {
+        return mapping != nullptr;
+    }
+
+    [[nodiscard]] auto GetAllocator() const -> Alloc {
+        return alloc;
+    }
+
+    [[nodiscard]] auto GetSize() const -> size_t {
         return size;
     }
 
-    [[nodiscard]] auto GetCapacity() const -> uint32_t {
+    [[nodiscard]] auto GetCapacity() const -> size_t {
         return capacity;
     }
 
-    void SetSize(uint32_t newSize) {
+    void SetSize(size_t newSize) {
         if (newSize > capacity) {
              throw length_error("Error: New size exceeds current capacity.");
         }
+        // Новые элементы инициализируются T(), лишние уничтожаются.
+        // После уменьшения в освободившиеся ячейки будут писать, поэтому
+        // отображение только для чтения заранее копируется
+        if (newSize != size) {
+            makeWritable();
+        }
+        if (newSize > size) {
+            uninitialized_value_construct(buffer + size, buffer + newSize);
+        } else {
+            destroyElements(newSize, size);
+        }
         size = newSize;
     }
 
-    void SetCapacity(uint32_t newCapacity) {
+    // Политика автоматического уменьшения буфера; переносится вместе
+    // с содержимым при копировании, перемещении и обмене.
+    // divisor 1 и 2 отвергаются (invalid_argument)
+    void SetShrinkPolicy(ShrinkPolicy policy) {
+        policy.validate();
+        shrinkPolicy = policy;
+        shrinkIfNeeded();
+    }
+
+    [[nodiscard]] auto GetShrinkPolicy() const -> ShrinkPolicy {
+        return shrinkPolicy;
+    }
+
+    // Уменьшение вместимости до текущего размера
+    void shrink_to_fit() {
+        if (capacity > size && mapping == nullptr) {
+            reallocate(size > 0 ? size : 1);
+        }
+    }
+
+    void SetCapacity(size_t newCapacity) {
         if (newCapacity < size) {
             throw length_error("Error: New capacity cannot be smaller than current size.");
         }
-        capacity = newCapacity;
+        if (newCapacity != capacity) {
+            reallocate(newCapacity > 0 ? newCapacity : 1);
+        }
     }
 };
 
+// Массив, первые N элементов которого хранятся без выделения памяти
+template <typename T, uint32_t N>
+using SmallArray = Array<T, allocator<T>, N>;
+
 #endif   // ARRAY_HPP
\ No newline at end of file
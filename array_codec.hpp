@@ -0,0 +1,363 @@
+#ifndef ARRAY_CODEC_HPP
+#define ARRAY_CODEC_HPP
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// Сжатие целочисленных массивов для MSAVE_COMPRESSED / MLOAD_COMPRESSED.
+// Для 32-битных типов — блоки по 128 значений с упаковкой битов; для
+// остальных целых типов — разности соседних элементов в zigzag-varint.
+namespace array_codec {
+
+enum class Codec : uint32_t {
+    BitPacked128 = 0,  // Блоки по 128 значений, распаковка на SSE2
+    DeltaVarint = 1,   // Разности соседних элементов, zigzag + LEB128
+};
+
+template <typename T>
+inline constexpr bool isBlockType = std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t>;
+
+template <typename T>
+inline constexpr Codec codecFor = isBlockType<T> ? Codec::BitPacked128 : Codec::DeltaVarint;
+
+// ---------------------------------------------------------------------------
+// BitPacked128. Блок: байт режима, байт ширины b, для режима FOR ещё uint32
+// base, затем 16 * b байт упакованных значений. Значения лежат "вертикально":
+// i-е значение блока попадает в дорожку i % 4 128-битного слова, поэтому одна
+// SSE2-команда сдвига распаковывает сразу четыре значения.
+//   FOR   — v[i] = x[i] - min блока (подходит случайным данным в узком диапазоне);
+//   Delta — v[i] = zigzag(x[i] - x[i - 4]) (подходит отсортированным данным),
+//           обратное преобразование — вертикальная префиксная сумма.
+// Неполный последний блок дополняется последним значением.
+// ---------------------------------------------------------------------------
+
+inline constexpr size_t blockValues = 128;
+
+enum class BlockMode : uint8_t { FOR = 0, Delta = 1 };
+
+inline auto zigzag32(uint32_t delta) -> uint32_t {
+    return (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+}
+
+inline auto unzigzag32(uint32_t value) -> uint32_t {
+    return (value >> 1) ^ (0u - (value & 1u));
+}
+
+// Упаковка 128 значений шириной bits в 4 * bits слов uint32 (вертикальная раскладка)
+inline void packBlock(const uint32_t* values, uint32_t bits, uint32_t* out) {
+    if (bits == 0) {
+        return;
+    }
+    uint32_t word[4] = {0, 0, 0, 0};
+    uint32_t shift = 0;
+    for (size_t j = 0; j < 32; j++) {
+        for (size_t lane = 0; lane < 4; lane++) {
+            word[lane] |= values[4 * j + lane] << shift;
+        }
+        if (shift + bits >= 32) {
+            memcpy(out, word, sizeof(word));
+            out += 4;
+            uint32_t used = 32 - shift;
+            for (size_t lane = 0; lane < 4; lane++) {
+                word[lane] = used < 32 ? values[4 * j + lane] >> used : 0;
+            }
+            shift = shift + bits - 32;
+        } else {
+            shift += bits;
+        }
+    }
+}
+
+#ifdef __SSE2__
+// Распаковка 128 значений; для каждой четвёрки значений вызывается finish(вектор, номер)
+template <typename Finish>
+inline void unpackBlock(const uint8_t* packed, uint32_t bits, Finish finish) {
+    if (bits == 0) {
+        for (size_t j = 0; j < 32; j++) {
+            finish(_mm_setzero_si128(), j);
+        }
+        return;
+    }
+    const __m128i mask = _mm_set1_epi32(bits == 32 ? -1 : static_cast<int>((1u << bits) - 1));
+    const __m128i* in = reinterpret_cast<const __m128i*>(packed);
+    __m128i cur = _mm_loadu_si128(in++);
+    uint32_t shift = 0;
+    for (size_t j = 0; j < 32; j++) {
+        __m128i v = _mm_srl_epi32(cur, _mm_cvtsi32_si128(static_cast<int>(shift)));
+        if (shift + bits > 32) {
+            // Значение пересекает границу слов
+            cur = _mm_loadu_si128(in++);
+            v = _mm_or_si128(v, _mm_sll_epi32(cur, _mm_cvtsi32_si128(static_cast<int>(32 - shift))));
+            shift = shift + bits - 32;
+        } else if (shift + bits == 32) {
+            if (j != 31) {
+                cur = _mm_loadu_si128(in++);
+            }
+            shift = 0;
+        } else {
+            shift += bits;
+        }
+        finish(_mm_and_si128(v, mask), j);
+    }
+}
+#else
+template <typename Finish>
+inline void unpackBlock(const uint32_t* packed, uint32_t bits, Finish finish) {
+    const uint32_t mask = bits == 32 ? ~0u : (1u << bits) - 1;
+    for (size_t lane = 0; lane < 4; lane++) {
+        uint32_t values[32];
+        uint64_t bitPos = 0;
+        for (size_t j = 0; j < 32; j++, bitPos += bits) {
+            size_t word = bitPos / 32;
+            uint32_t shift = bitPos % 32;
+            uint64_t chunk = packed[4 * word + lane];
+            if (shift + bits > 32) {
+                chunk |= static_cast<uint64_t>(packed[4 * (word + 1) + lane]) << 32;
+            }
+            values[j] = bits == 0 ? 0 : static_cast<uint32_t>(chunk >> shift) & mask;
+        }
+        finish(values, lane);
+    }
+}
+#endif
+
+// Сжатие элементов [first, n) массива data; first кратно blockValues,
+// поэтому массив можно сжимать по частям
+template <typename T>
+void encodeBlocks(const T* data, size_t first, size_t n, std::vector<uint8_t>& out) {
+    uint32_t block[blockValues];
+    uint32_t prev[4] = {0, 0, 0, 0};  // Последние 4 значения предыдущего блока
+    uint32_t delta[blockValues];
+    uint32_t packed[blockValues];
+    if (first > 0) {
+        memcpy(prev, data + first - 4, sizeof(prev));
+    }
+    for (size_t start = first; start < n; start += blockValues) {
+        size_t count = n - start < blockValues ? n - start : blockValues;
+        memcpy(block, data + start, count * sizeof(uint32_t));
+        for (size_t i = count; i < blockValues; i++) {
+            block[i] = block[count - 1];
+        }
+
+        // Ширина в режиме FOR (по беззнаковому или знаковому минимуму типа T)
+        T minValue = static_cast<T>(block[0]);
+        T maxValue = minValue;
+        for (size_t i = 1; i < blockValues; i++) {
+            T value = static_cast<T>(block[i]);
+            minValue = value < minValue ? value : minValue;
+            maxValue = value > maxValue ? value : maxValue;
+        }
+        uint32_t base = static_cast<uint32_t>(minValue);
+        uint32_t forBits = static_cast<uint32_t>(std::bit_width(static_cast<uint32_t>(maxValue) - base));
+
+        // Ширина в режиме Delta
+        uint32_t deltaOr = 0;
+        for (size_t i = 0; i < blockValues; i++) {
+            uint32_t before = i < 4 ? prev[i] : block[i - 4];
+            delta[i] = zigzag32(block[i] - before);
+            deltaOr |= delta[i];
+        }
+        uint32_t deltaBits = static_cast<uint32_t>(std::bit_width(deltaOr));
+
+        BlockMode mode = 16 * deltaBits <= 16 * forBits + sizeof(uint32_t) ? BlockMode::Delta : BlockMode::FOR;
+        uint32_t bits = mode == BlockMode::Delta ? deltaBits : forBits;
+        if (mode == BlockMode::FOR) {
+            for (size_t i = 0; i < blockValues; i++) {
+                delta[i] = block[i] - base;
+            }
+        }
+        packBlock(delta, bits, packed);
+
+        size_t offset = out.size();
+        size_t blockBytes = 2 + (mode == BlockMode::FOR ? sizeof(base) : 0) + 16 * bits;
+        out.resize(offset + blockBytes);
+        uint8_t* dst = out.data() + offset;
+        *dst++ = static_cast<uint8_t>(mode);
+        *dst++ = static_cast<uint8_t>(bits);
+        if (mode == BlockMode::FOR) {
+            memcpy(dst, &base, sizeof(base));
+            dst += sizeof(base);
+        }
+        memcpy(dst, packed, 16 * bits);
+        memcpy(prev, block + blockValues - 4, sizeof(prev));
+    }
+}
+
+// Состояние потокового декодирования: сжатые данные подаются кусками,
+// и между вызовами нужно помнить последние декодированные значения
+struct DecodeState {
+    alignas(16) uint32_t prev[4] = {0, 0, 0, 0};  // BitPacked128: последние 4 значения
+    uint64_t prevValue = 0;                        // DeltaVarint: предыдущее значение
+    bool corrupt = false;
+};
+
+// Размер куска, которым MLOAD_COMPRESSED читает сжатые данные
+inline constexpr size_t chunkBytes = 1 << 20;
+// Сколько элементов MSAVE_COMPRESSED сжимает за один проход (кратно blockValues)
+inline constexpr size_t chunkValues = 1 << 18;
+
+// Декодирование не больше n значений из [in, in + bytes). Возвращает число
+// декодированных значений, в consumed — число использованных байт. Неполный
+// блок в конце куска не трогается и ждёт следующего вызова
+template <typename T>
+auto decodeBlocks(const uint8_t* in, size_t bytes, T* data, size_t n, DecodeState& state,
+                  size_t& consumed) -> size_t {
+    const uint8_t* begin = in;
+    const uint8_t* end = in + bytes;
+    alignas(16) uint32_t block[blockValues];
+#ifndef __SSE2__
+    uint32_t packed[blockValues];
+#endif
+    size_t start = 0;
+    for (; start < n; start += blockValues) {
+        if (end - in < 2) {
+            break;
+        }
+        BlockMode mode = static_cast<BlockMode>(in[0]);
+        uint32_t bits = in[1];
+        if (bits > 32 || (mode != BlockMode::FOR && mode != BlockMode::Delta)) {
+            state.corrupt = true;
+            break;
+        }
+        size_t baseBytes = mode == BlockMode::FOR ? sizeof(uint32_t) : 0;
+        if (static_cast<size_t>(end - in) < 2 + baseBytes + 16 * bits) {
+            break;
+        }
+        uint32_t base = 0;
+        memcpy(&base, in + 2, baseBytes);
+        const uint8_t* words = in + 2 + baseBytes;
+        in = words + 16 * bits;
+
+        // Полный блок распаковывается прямо в массив, неполный — через block
+        size_t count = n - start < blockValues ? n - start : blockValues;
+        uint32_t* dst = count == blockValues ? reinterpret_cast<uint32_t*>(data + start) : block;
+#ifdef __SSE2__
+        if (mode == BlockMode::FOR) {
+            const __m128i vbase = _mm_set1_epi32(static_cast<int>(base));
+            unpackBlock(words, bits, [&](__m128i v, size_t j) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * j), _mm_add_epi32(v, vbase));
+            });
+        } else {
+            const __m128i one = _mm_set1_epi32(1);
+            __m128i last = _mm_load_si128(reinterpret_cast<const __m128i*>(state.prev));
+            unpackBlock(words, bits, [&](__m128i v, size_t j) {
+                __m128i sign = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one));
+                last = _mm_add_epi32(last, _mm_xor_si128(_mm_srli_epi32(v, 1), sign));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4 * j), last);
+            });
+        }
+#else
+        memcpy(packed, words, 16 * bits);
+        unpackBlock(packed, bits, [&](const uint32_t* values, size_t lane) {
+            uint32_t last = state.prev[lane];
+            for (size_t j = 0; j < 32; j++) {
+                if (mode == BlockMode::FOR) {
+                    dst[4 * j + lane] = values[j] + base;
+                } else {
+                    last += unzigzag32(values[j]);
+                    dst[4 * j + lane] = last;
+                }
+            }
+        });
+#endif
+        if (dst == block) {
+            memcpy(data + start, block, count * sizeof(uint32_t));
+        }
+        memcpy(state.prev, dst + blockValues - 4, sizeof(state.prev));
+    }
+    consumed = static_cast<size_t>(in - begin);
+    return start < n ? start : n;
+}
+
+// ---------------------------------------------------------------------------
+// DeltaVarint: zigzag(x[i] - x[i - 1]) в LEB128 (7 бит на байт)
+// ---------------------------------------------------------------------------
+
+template <typename T>
+void encodeVarint(const T* data, size_t first, size_t n, std::vector<uint8_t>& out) {
+    using U = std::make_unsigned_t<T>;
+    using S = std::make_signed_t<T>;
+    constexpr int bits = 8 * sizeof(T);
+    U prev = first > 0 ? static_cast<U>(data[first - 1]) : 0;
+    for (size_t i = first; i < n; i++) {
+        U delta = static_cast<U>(static_cast<U>(data[i]) - prev);
+        prev = static_cast<U>(data[i]);
+        uint64_t value = static_cast<U>(static_cast<U>(delta << 1) ^ static_cast<U>(static_cast<S>(delta) >> (bits - 1)));
+        while (value >= 0x80) {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+}
+
+template <typename T>
+auto decodeVarint(const uint8_t* in, size_t bytes, T* data, size_t n, DecodeState& state,
+                  size_t& consumed) -> size_t {
+    using U = std::make_unsigned_t<T>;
+    const uint8_t* begin = in;
+    const uint8_t* end = in + bytes;
+    U prev = static_cast<U>(state.prevValue);
+    size_t i = 0;
+    for (; i < n; i++) {
+        const uint8_t* cursor = in;
+        uint64_t value = 0;
+        uint32_t shift = 0;
+        bool complete = false;
+        while (cursor != end) {
+            if (shift >= 8 * sizeof(T)) {
+                state.corrupt = true;
+                break;
+            }
+            uint8_t byte = *cursor++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                complete = true;
+                break;
+            }
+            shift += 7;
+        }
+        if (!complete) {
+            break;  // Значение не поместилось в кусок или данные повреждены
+        }
+        in = cursor;
+        U zz = static_cast<U>(value);
+        U delta = static_cast<U>((zz >> 1) ^ static_cast<U>(0 - (zz & 1)));
+        prev = static_cast<U>(prev + delta);
+        data[i] = static_cast<T>(prev);
+    }
+    state.prevValue = prev;
+    consumed = static_cast<size_t>(in - begin);
+    return i;
+}
+
+// Сжатие элементов [first, n) с дописыванием в out (first кратно blockValues)
+template <typename T>
+void encode(const T* data, size_t first, size_t n, std::vector<uint8_t>& out) {
+    if constexpr (isBlockType<T>) {
+        encodeBlocks(data, first, n, out);
+    } else {
+        encodeVarint(data, first, n, out);
+    }
+}
+
+template <typename T>
+auto decode(const uint8_t* in, size_t bytes, T* data, size_t n, DecodeState& state, size_t& consumed) -> size_t {
+    if constexpr (isBlockType<T>) {
+        return decodeBlocks(in, bytes, data, n, state, consumed);
+    } else {
+        return decodeVarint(in, bytes, data, n, state, consumed);
+    }
+}
+
+}  // namespace array_codec
+
+#endif  // ARRAY_CODEC_HPP
@@ -0,0 +1,488 @@
+#ifndef ARRAY_SIMD_HPP
+#define ARRAY_SIMD_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ARRAY_SIMD_X86 1
+#endif
+
+// Векторные ядра поиска и свёртки для Array<int32_t> / Array<uint32_t>.
+// Набор инструкций (AVX2, SSE4.1 или скалярный код) выбирается
+// во время выполнения по CPUID, поэтому сборка не требует -mavx2.
+namespace array_simd {
+
+enum class Level { Scalar, SSE4, AVX2 };
+
+// Типы, для которых есть векторные ядра
+template <typename T>
+inline constexpr bool hasKernels = std::is_same_v<T, int32_t> || std::is_same_v<T, uint32_t>;
+
+// Тип суммы: 64-битный для целых, сам T для остальных типов
+template <typename T>
+using SumType = std::conditional_t<std::is_integral_v<T>,
+                                   std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>,
+                                   T>;
+
+inline auto detectLevel() -> Level {
+#ifdef ARRAY_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return Level::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return Level::SSE4;
+    }
+#endif
+    return Level::Scalar;
+}
+
+inline auto supportedLevel() -> Level {
+    static const Level level = detectLevel();
+    return level;
+}
+
+inline auto activeLevel() -> Level& {
+    static Level level = supportedLevel();
+    return level;
+}
+
+// Принудительный выбор набора инструкций (не выше поддерживаемого процессором)
+inline void setLevel(Level level) {
+    activeLevel() = level > supportedLevel() ? supportedLevel() : level;
+}
+
+inline auto getLevel() -> Level {
+    return activeLevel();
+}
+
+// Скалярные версии (также обрабатывают хвосты векторных циклов)
+
+template <typename T>
+inline auto findScalar(const T* data, size_t n, T value) -> size_t {
+    for (size_t i = 0; i < n; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return n;
+}
+
+template <typename T>
+inline auto countScalar(const T* data, size_t n, T value) -> size_t {
+    size_t result = 0;
+    for (size_t i = 0; i < n; i++) {
+        result += data[i] == value ? 1 : 0;
+    }
+    return result;
+}
+
+template <typename T>
+inline auto minScalar(const T* data, size_t n, T init) -> T {
+    T result = init;
+    for (size_t i = 0; i < n; i++) {
+        if (data[i] < result) {
+            result = data[i];
+        }
+    }
+    return result;
+}
+
+template <typename T>
+inline auto maxScalar(const T* data, size_t n, T init) -> T {
+    T result = init;
+    for (size_t i = 0; i < n; i++) {
+        if (result < data[i]) {
+            result = data[i];
+        }
+    }
+    return result;
+}
+
+template <typename T>
+inline auto sumScalar(const T* data, size_t n) -> SumType<T> {
+    SumType<T> result = SumType<T>();
+    for (size_t i = 0; i < n; i++) {
+        result += data[i];
+    }
+    return result;
+}
+
+// Копирует элементы из [lo, hi] в out, возвращает их количество
+template <typename T>
+inline auto filterRangeScalar(const T* data, size_t n, T lo, T hi, T* out) -> size_t {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (!(data[i] < lo) && !(hi < data[i])) {
+            out[count++] = data[i];
+        }
+    }
+    return count;
+}
+
+#ifdef ARRAY_SIMD_X86
+
+// Сдвиг знакового бита: сравнение беззнаковых чисел через знаковое cmpgt
+template <typename T>
+inline constexpr int32_t signBias = std::is_signed_v<T> ? 0 : INT32_MIN;
+
+// SSE4.1
+
+template <typename T>
+__attribute__((target("sse4.1"))) inline auto findSse4(const T* data, size_t n, T value) -> size_t {
+    const __m128i needle = _mm_set1_epi32(static_cast<int32_t>(value));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    size_t tail = findScalar(data + i, n - i, value);
+    return i + tail;
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) inline auto countSse4(const T* data, size_t n, T value) -> size_t {
+    const __m128i needle = _mm_set1_epi32(static_cast<int32_t>(value));
+    size_t result = 0;
+    size_t i = 0;
+    // Счётчики по дорожкам сбрасываются до переполнения 32 бит
+    while (i + 4 <= n) {
+        __m128i acc = _mm_setzero_si128();
+        size_t blockEnd = n - i > (size_t(1) << 32) ? i + (size_t(1) << 32) : n;
+        for (; i + 4 <= blockEnd; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, needle));
+        }
+        alignas(16) uint32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        result += static_cast<size_t>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+    }
+    return result + countScalar(data + i, n - i, value);
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) inline auto minMaxSse4(const T* data, size_t n, bool wantMin) -> T {
+    size_t i = 0;
+    T result = data[0];
+    if (n >= 4) {
+        __m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        for (i = 4; i + 4 <= n; i += 4) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            if constexpr (std::is_signed_v<T>) {
+                acc = wantMin ? _mm_min_epi32(acc, v) : _mm_max_epi32(acc, v);
+            } else {
+                acc = wantMin ? _mm_min_epu32(acc, v) : _mm_max_epu32(acc, v);
+            }
+        }
+        alignas(16) T lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        result = wantMin ? minScalar(lanes, 4, lanes[0]) : maxScalar(lanes, 4, lanes[0]);
+    }
+    return wantMin ? minScalar(data + i, n - i, result) : maxScalar(data + i, n - i, result);
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) inline auto widen64Sse4(__m128i v) -> __m128i {
+    if constexpr (std::is_signed_v<T>) {
+        return _mm_cvtepi32_epi64(v);
+    } else {
+        return _mm_cvtepu32_epi64(v);
+    }
+}
+
+template <typename T>
+__attribute__((target("sse4.1"))) inline auto sumSse4(const T* data, size_t n) -> SumType<T> {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        acc = _mm_add_epi64(acc, widen64Sse4<T>(v));
+        acc = _mm_add_epi64(acc, widen64Sse4<T>(_mm_unpackhi_epi64(v, v)));
+    }
+    alignas(16) SumType<T> lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+    return lanes[0] + lanes[1] + sumScalar(data + i, n - i);
+}
+
+// Таблица перестановок pshufb: выбранные дорожки 4-битной маски сдвигаются в начало
+inline auto compressTable4() -> const uint8_t (&)[16][16] {
+    struct Table {
+        uint8_t shuffle[16][16];
+        Table() : shuffle() {
+            for (int mask = 0; mask < 16; mask++) {
+                int pos = 0;
+                for (int lane = 0; lane < 4; lane++) {
+                    if (mask & (1 << lane)) {
+                        for (int b = 0; b < 4; b++) {
+                            shuffle[mask][pos * 4 + b] = static_cast<uint8_t>(lane * 4 + b);
+                        }
+                        pos++;
+                    }
+                }
+                for (int b = pos * 4; b < 16; b++) {
+                    shuffle[mask][b] = 0x80;
+                }
+            }
+        }
+    };
+    static const Table table;
+    return table.shuffle;
+}
+
+// out должен вмещать n + 4 элемента: запись идёт целыми векторами
+template <typename T>
+__attribute__((target("sse4.1"))) inline auto filterRangeSse4(const T* data, size_t n, T lo, T hi,
+                                                               T* out) -> size_t {
+    const auto& table = compressTable4();
+    const __m128i bias = _mm_set1_epi32(signBias<T>);
+    const __m128i loV = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(lo)), bias);
+    const __m128i hiV = _mm_xor_si128(_mm_set1_epi32(static_cast<int32_t>(hi)), bias);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i biased = _mm_xor_si128(v, bias);
+        __m128i outside = _mm_or_si128(_mm_cmpgt_epi32(loV, biased), _mm_cmpgt_epi32(biased, hiV));
+        int mask = ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF;
+        __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table[mask]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + count), _mm_shuffle_epi8(v, shuffle));
+        count += __builtin_popcount(mask);
+    }
+    return count + filterRangeScalar(data + i, n - i, lo, hi, out + count);
+}
+
+// AVX2
+
+template <typename T>
+__attribute__((target("avx2"))) inline auto findAvx2(const T* data, size_t n, T value) -> size_t {
+    const __m256i needle = _mm256_set1_epi32(static_cast<int32_t>(value));
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8));
+        __m256i eq = _mm256_or_si256(_mm256_cmpeq_epi32(a, needle), _mm256_cmpeq_epi32(b, needle));
+        if (!_mm256_testz_si256(eq, eq)) {
+            break;
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    size_t tail = findScalar(data + i, n - i, value);
+    return i + tail;
+}
+
+template <typename T>
+__attribute__((target("avx2"))) inline auto countAvx2(const T* data, size_t n, T value) -> size_t {
+    const __m256i needle = _mm256_set1_epi32(static_cast<int32_t>(value));
+    size_t result = 0;
+    size_t i = 0;
+    while (i + 8 <= n) {
+        __m256i acc = _mm256_setzero_si256();
+        size_t blockEnd = n - i > (size_t(1) << 32) ? i + (size_t(1) << 32) : n;
+        for (; i + 8 <= blockEnd; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(v, needle));
+        }
+        alignas(32) uint32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        for (uint32_t lane : lanes) {
+            result += lane;
+        }
+    }
+    return result + countScalar(data + i, n - i, value);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) inline auto minMaxAvx2(const T* data, size_t n, bool wantMin) -> T {
+    size_t i = 0;
+    T result = data[0];
+    if (n >= 8) {
+        __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        for (i = 8; i + 8 <= n; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            if constexpr (std::is_signed_v<T>) {
+                acc = wantMin ? _mm256_min_epi32(acc, v) : _mm256_max_epi32(acc, v);
+            } else {
+                acc = wantMin ? _mm256_min_epu32(acc, v) : _mm256_max_epu32(acc, v);
+            }
+        }
+        alignas(32) T lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        result = wantMin ? minScalar(lanes, 8, lanes[0]) : maxScalar(lanes, 8, lanes[0]);
+    }
+    return wantMin ? minScalar(data + i, n - i, result) : maxScalar(data + i, n - i, result);
+}
+
+template <typename T>
+__attribute__((target("avx2"))) inline auto widen64Avx2(__m128i v) -> __m256i {
+    if constexpr (std::is_signed_v<T>) {
+        return _mm256_cvtepi32_epi64(v);
+    } else {
+        return _mm256_cvtepu32_epi64(v);
+    }
+}
+
+template <typename T>
+__attribute__((target("avx2"))) inline auto sumAvx2(const T* data, size_t n) -> SumType<T> {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        acc = _mm256_add_epi64(acc, widen64Avx2<T>(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, widen64Avx2<T>(_mm256_extracti128_si256(v, 1)));
+    }
+    alignas(32) SumType<T> lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumScalar(data + i, n - i);
+}
+
+// Таблица индексов для vpermd: выбранные дорожки 8-битной маски сдвигаются в начало
+inline auto compressTable8() -> const uint32_t (&)[256][8] {
+    struct Table {
+        uint32_t perm[256][8];
+        Table() : perm() {
+            for (int mask = 0; mask < 256; mask++) {
+                int pos = 0;
+                for (int lane = 0; lane < 8; lane++) {
+                    if (mask & (1 << lane)) {
+                        perm[mask][pos++] = static_cast<uint32_t>(lane);
+                    }
+                }
+            }
+        }
+    };
+    static const Table table;
+    return table.perm;
+}
+
+// out должен вмещать n + 8 элементов: запись идёт целыми векторами
+template <typename T>
+__attribute__((target("avx2"))) inline auto filterRangeAvx2(const T* data, size_t n, T lo, T hi,
+                                                             T* out) -> size_t {
+    const auto& table = compressTable8();
+    const __m256i bias = _mm256_set1_epi32(signBias<T>);
+    const __m256i loV = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(lo)), bias);
+    const __m256i hiV = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int32_t>(hi)), bias);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i biased = _mm256_xor_si256(v, bias);
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(loV, biased),
+                                          _mm256_cmpgt_epi32(biased, hiV));
+        int mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFF;
+        __m256i perm = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(table[mask]));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + count), _mm256_permutevar8x32_epi32(v, perm));
+        count += __builtin_popcount(mask);
+    }
+    return count + filterRangeScalar(data + i, n - i, lo, hi, out + count);
+}
+
+#endif  // ARRAY_SIMD_X86
+
+// Диспетчеры: выбирают ядро по активному набору инструкций
+
+// Запас элементов в выходном буфере filterRange под векторную запись
+inline constexpr size_t filterSlack = 8;
+
+template <typename T>
+inline auto find(const T* data, size_t n, T value) -> size_t {
+#ifdef ARRAY_SIMD_X86
+    if constexpr (hasKernels<T>) {
+        switch (getLevel()) {
+            case Level::AVX2: return findAvx2(data, n, value);
+            case Level::SSE4: return findSse4(data, n, value);
+            default: break;
+        }
+    }
+#endif
+    return findScalar(data, n, value);
+}
+
+template <typename T>
+inline auto count(const T* data, size_t n, T value) -> size_t {
+#ifdef ARRAY_SIMD_X86
+    if constexpr (hasKernels<T>) {
+        switch (getLevel()) {
+            case Level::AVX2: return countAvx2(data, n, value);
+            case Level::SSE4: return countSse4(data, n, value);
+            default: break;
+        }
+    }
+#endif
+    return countScalar(data, n, value);
+}
+
+// n должно быть больше нуля
+template <typename T>
+inline auto min(const T* data, size_t n) -> T {
+#ifdef ARRAY_SIMD_X86
+    if constexpr (hasKernels<T>) {
+        switch (getLevel()) {
+            case Level::AVX2: return minMaxAvx2(data, n, true);
+            case Level::SSE4: return minMaxSse4(data, n, true);
+            default: break;
+        }
+    }
+#endif
+    return minScalar(data + 1, n - 1, data[0]);
+}
+
+// n должно быть больше нуля
+template <typename T>
+inline auto max(const T* data, size_t n) -> T {
+#ifdef ARRAY_SIMD_X86
+    if constexpr (hasKernels<T>) {
+        switch (getLevel()) {
+            case Level::AVX2: return minMaxAvx2(data, n, false);
+            case Level::SSE4: return minMaxSse4(data, n, false);
+            default: break;
+        }
+    }
+#endif
+    return maxScalar(data + 1, n - 1, data[0]);
+}
+
+template <typename T>
+inline auto sum(const T* data, size_t n) -> SumType<T> {
+#ifdef ARRAY_SIMD_X86
+    if constexpr (hasKernels<T>) {
+        switch (getLevel()) {
+            case Level::AVX2: return sumAvx2(data, n);
+            case Level::SSE4: return sumSse4(data, n);
+            default: break;
+        }
+    }
+#endif
+    return sumScalar(data, n);
+}
+
+// out должен вмещать n + filterSlack элементов
+template <typename T>
+inline auto filterRange(const T* data, size_t n, T lo, T hi, T* out) -> size_t {
+#ifdef ARRAY_SIMD_X86
+    if constexpr (hasKernels<T>) {
+        switch (getLevel()) {
+            case Level::AVX2: return filterRangeAvx2(data, n, lo, hi, out);
+            case Level::SSE4: return filterRangeSse4(data, n, lo, hi, out);
+            default: break;
+        }
+    }
+#endif
+    return filterRangeScalar(data, n, lo, hi, out);
+}
+
+}  // namespace array_simd
+
+#endif  // ARRAY_SIMD_HPP
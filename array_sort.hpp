@@ -0,0 +1,274 @@
+#ifndef ARRAY_SORT_HPP
+#define ARRAY_SORT_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <type_traits>
+
+// Движки сортировки для Array: параллельная сортировка слиянием для любых
+// сравнимых T и LSD radix sort для целочисленных ключей.
+namespace array_sort {
+
+// Меньшие массивы выгоднее сортировать в одном потоке
+inline constexpr size_t minParallelSize = 1 << 15;
+
+inline auto resolveThreads(unsigned threads) -> unsigned {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    return threads == 0 ? 1 : threads;
+}
+
+// Запускает job(i) для i в [0, count): count - 1 задач в новых потоках, одна
+// в текущем (как и задачи потоков, которые не удалось создать). Исключения
+// задач не выходят за пределы потока: все потоки дожидаются, затем
+// пробрасывается первое
+template <typename Job>
+void runParallel(size_t count, Job&& job) {
+    std::exception_ptr error;
+    std::mutex errorLock;
+    auto guarded = [&job, &error, &errorLock](size_t i) {
+        try {
+            job(i);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(errorLock);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    size_t spawned = 1;
+    try {
+        workers.reserve(count - 1);
+        for (; spawned < count; spawned++) {
+            workers.emplace_back(guarded, spawned);
+        }
+    } catch (...) {
+        // Не хватило ресурсов на поток: оставшиеся задачи выполняются здесь
+    }
+    guarded(0);
+    for (size_t i = spawned; i < count; i++) {
+        guarded(i);
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Ко-ранг: сколько элементов левой части [a, a + m) входит в первые k
+// элементов слияния с правой [b, b + l). При равенстве левые идут первыми
+template <typename T, typename Compare>
+auto coRank(const T* a, size_t m, const T* b, size_t l, size_t k, Compare& comp) -> size_t {
+    size_t lo = k > l ? k - l : 0;
+    size_t hi = std::min(k, m);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        if (j > 0 && i < m && !comp(b[j - 1], a[i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// Часть слияния двух соседних блоков: [a, aEnd) и [b, bEnd) сливаются
+// в scratch начиная с out
+struct MergePart {
+    size_t a;
+    size_t aEnd;
+    size_t b;
+    size_t bEnd;
+    size_t out;
+};
+
+// Каждый поток сортирует свой блок std::sort, затем блоки попарно сливаются
+// раундами. Слияние пары делится по ко-рангам на независимые части, так что
+// все потоки заняты и в последнем раунде, где пара всего одна. Части
+// сливаются во временный буфер и переносятся обратно. Если компаратор
+// бросает, исключение пробрасывается после завершения всех потоков,
+// а массив остаётся в допустимом, но неопределённом состоянии
+template <typename T, typename Compare>
+void parallelMergeSort(T* data, size_t n, Compare comp, unsigned threads) {
+    threads = resolveThreads(threads);
+    if (threads == 1 || n < minParallelSize) {
+        std::sort(data, data + n, comp);
+        return;
+    }
+
+    size_t chunks = std::min<size_t>(threads, n / (minParallelSize / 2));
+    std::vector<size_t> bounds(chunks + 1);
+    for (size_t i = 0; i <= chunks; i++) {
+        bounds[i] = n * i / chunks;
+    }
+
+    runParallel(chunks, [&](size_t i) {
+        std::sort(data + bounds[i], data + bounds[i + 1], comp);
+    });
+
+    // Неинициализированный буфер: элементы в нём живут только между
+    // слиянием и переносом обратно
+    struct Scratch {
+        T* ptr;
+        size_t count;
+
+        ~Scratch() {
+            std::allocator<T>().deallocate(ptr, count);
+        }
+    };
+    Scratch scratchHolder{std::allocator<T>().allocate(n), n};
+    T* scratch = scratchHolder.ptr;
+
+    std::vector<MergePart> parts;
+    std::vector<char> merged;
+    for (size_t width = 1; width < chunks; width *= 2) {
+        size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+        size_t split = std::max<size_t>(1, threads / pairs);
+        parts.clear();
+        for (size_t p = 0; p < pairs; p++) {
+            size_t first = p * 2 * width;
+            size_t middle = std::min(first + width, chunks);
+            size_t last = std::min(first + 2 * width, chunks);
+            if (middle >= last) {
+                continue;  // Непарный блок остаётся на месте
+            }
+            const T* a = data + bounds[first];
+            const T* b = data + bounds[middle];
+            size_t m = bounds[middle] - bounds[first];
+            size_t l = bounds[last] - bounds[middle];
+            size_t prevK = 0;
+            size_t prevI = 0;
+            for (size_t s = 1; s <= split; s++) {
+                size_t k = (m + l) * s / split;
+                size_t i = s == split ? m : coRank(a, m, b, l, k, comp);
+                parts.push_back({bounds[first] + prevI, bounds[first] + i,
+                                 bounds[middle] + (prevK - prevI), bounds[middle] + (k - i),
+                                 bounds[first] + prevK});
+                prevK = k;
+                prevI = i;
+            }
+        }
+
+        // Слияние в scratch; часть, в которой бросил компаратор, сама
+        // разрушает свои элементы, завершённые — после ожидания всех
+        merged.assign(parts.size(), 0);
+        try {
+            runParallel(parts.size(), [&](size_t q) {
+                const MergePart& part = parts[q];
+                T* a = data + part.a;
+                T* aEnd = data + part.aEnd;
+                T* b = data + part.b;
+                T* bEnd = data + part.bEnd;
+                T* out = scratch + part.out;
+                T* cur = out;
+                try {
+                    while (a != aEnd && b != bEnd) {
+                        ::new (static_cast<void*>(cur)) T(std::move(comp(*b, *a) ? *b++ : *a++));
+                        ++cur;
+                    }
+                    cur = std::uninitialized_move(a, aEnd, cur);
+                    std::uninitialized_move(b, bEnd, cur);
+                } catch (...) {
+                    std::destroy(out, cur);
+                    throw;
+                }
+                merged[q] = 1;
+            });
+        } catch (...) {
+            for (size_t q = 0; q < parts.size(); q++) {
+                if (merged[q] != 0) {
+                    const MergePart& part = parts[q];
+                    T* out = scratch + part.out;
+                    std::destroy(out, out + (part.aEnd - part.a) + (part.bEnd - part.b));
+                }
+            }
+            throw;
+        }
+
+        // Перенос обратно; части не пересекаются, поэтому тоже параллельно
+        runParallel(parts.size(), [&](size_t q) {
+            const MergePart& part = parts[q];
+            T* out = scratch + part.out;
+            T* outEnd = out + (part.aEnd - part.a) + (part.bEnd - part.b);
+            try {
+                std::move(out, outEnd, data + part.out);
+            } catch (...) {
+                std::destroy(out, outEnd);
+                throw;
+            }
+            std::destroy(out, outEnd);
+        });
+    }
+}
+
+// Ключ для поразрядной сортировки: у знаковых типов инвертируется знаковый бит,
+// чтобы беззнаковый порядок ключей совпадал с порядком значений
+template <typename T>
+inline auto radixKey(T value) -> std::make_unsigned_t<T> {
+    using U = std::make_unsigned_t<T>;
+    U key = static_cast<U>(value);
+    if constexpr (std::is_signed_v<T>) {
+        key ^= U(1) << (sizeof(T) * 8 - 1);
+    }
+    return key;
+}
+
+// LSD radix sort по байтам. Гистограммы всех разрядов строятся за один проход;
+// разряд, одинаковый у всех элементов, пропускается
+template <typename T>
+void radixSort(T* data, size_t n) {
+    static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+                  "radixSort requires an integral element type");
+    if (n < 2) {
+        return;
+    }
+    constexpr size_t passes = sizeof(T);
+    std::vector<size_t> histogram(passes * 256, 0);
+    for (size_t i = 0; i < n; i++) {
+        auto key = radixKey(data[i]);
+        for (size_t pass = 0; pass < passes; pass++) {
+            histogram[pass * 256 + ((key >> (pass * 8)) & 0xFF)]++;
+        }
+    }
+
+    std::unique_ptr<T[]> scratch(new T[n]);
+    T* from = data;
+    T* to = scratch.get();
+    for (size_t pass = 0; pass < passes; pass++) {
+        size_t* counts = histogram.data() + pass * 256;
+        auto firstKey = radixKey(from[0]);
+        if (counts[(firstKey >> (pass * 8)) & 0xFF] == n) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t digit = 0; digit < 256; digit++) {
+            size_t count = counts[digit];
+            counts[digit] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < n; i++) {
+            auto digit = (radixKey(from[i]) >> (pass * 8)) & 0xFF;
+            to[counts[digit]++] = from[i];
+        }
+        std::swap(from, to);
+    }
+    if (from != data) {
+        std::memcpy(data, from, n * sizeof(T));
+    }
+}
+
+}  // namespace array_sort
+
+#endif  // ARRAY_SORT_HPP
@@ -0,0 +1,152 @@
+#include <iostream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <boost/timer/timer.hpp>
+#include <boost/random.hpp>
+#include <sys/resource.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "array.hpp"
+#include "allocators.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество элементов (можно переопределить первым аргументом)
+uint64_t NUM_ELEMENTS = 100000000;
+// Количество случайных чтений
+const uint32_t NUM_READS = 20000000;
+
+// Счётчик промахов dTLB через perf_event_open; если счётчик недоступен
+// (нет прав или виртуализация), замер пропускается
+class TlbCounter {
+ private:
+    int fd;
+
+ public:
+    TlbCounter() : fd(-1) {
+#ifdef __linux__
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB
+                    | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~TlbCounter() {
+#ifdef __linux__
+        if (fd >= 0) {
+            close(fd);
+        }
+#endif
+    }
+
+    [[nodiscard]] auto available() const -> bool {
+        return fd >= 0;
+    }
+
+    void start() {
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    auto stop() -> uint64_t {
+        uint64_t value = 0;
+#ifdef __linux__
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &value, sizeof(value)) != sizeof(value)) {
+                value = 0;
+            }
+        }
+#endif
+        return value;
+    }
+};
+
+// Количество "мягких" страничных отказов процесса
+auto minorFaults() -> long {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+}
+
+// Заполнение массива и случайные чтения из него
+template <typename Alloc>
+void run_workload(const string& name, const Alloc& allocator) {
+    cout << "[" << name << "]" << endl;
+
+    Array<int, Alloc> arr(allocator);
+    long faultsBefore = minorFaults();
+    cpu_timer tFill;
+    for (uint64_t i = 0; i < NUM_ELEMENTS; i++) {
+        arr.MPUSH_BACK(static_cast<int>(i));
+    }
+    tFill.stop();
+    long faultsFill = minorFaults() - faultsBefore;
+    cout << "  Заполнение:       " << tFill.format();
+    cout << "  Страничные отказы: " << faultsFill << endl;
+
+    // Случайные чтения по всему буферу нагружают TLB
+    boost::random::mt19937 gen(42);
+    boost::random::uniform_int_distribution<uint32_t> dist(0, arr.GetSize() - 1);
+    uint32_t* indices = new uint32_t[NUM_READS];
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        indices[i] = dist(gen);
+    }
+
+    TlbCounter tlb;
+    int64_t sum = 0;
+    tlb.start();
+    cpu_timer tRead;
+    for (uint32_t i = 0; i < NUM_READS; i++) {
+        sum += arr.MGET_UNCHECKED(indices[i]);
+    }
+    tRead.stop();
+    uint64_t misses = tlb.stop();
+    delete[] indices;
+
+    cout << "  Случайные чтения (контрольная сумма " << sum << "):" << tRead.format();
+    if (tlb.available()) {
+        cout << "  Промахи dTLB:     " << misses << endl;
+    } else {
+        cout << "  Промахи dTLB:     недоступно (perf_event_open)" << endl;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        NUM_ELEMENTS = stoull(argv[1]);
+    }
+    cout << "Запуск Benchmarks для аллокаторов Array<T>" << endl;
+    cout << "Количество элементов: " << NUM_ELEMENTS << endl;
+
+    try {
+        run_workload("std::allocator", allocator<int>());
+        run_workload("HugePageAllocator", HugePageAllocator<int>());
+        {
+            Arena arena(64 << 20);
+            run_workload("ArenaAllocator", ArenaAllocator<int>(arena));
+        }
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
@@ -1,10 +1,16 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <filesystem>
+#include <numeric>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
 #include <boost/timer/timer.hpp>
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "array.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 
@@ -12,6 +18,37 @@ using namespace std;
 const uint32_t SMALL_DATA_SIZE = 10000;
 const uint32_t LARGE_DATA_SIZE = 1000000;
 
+// Счётчик выделений памяти в bench_string_growth
+static uint64_t g_allocCount = 0;
+
+// Аллокатор, считающий выделения; передаётся строкам и Array в параметре Alloc,
+// поэтому остальные выделения программы не затрагиваются
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}  // NOLINT
+
+    auto allocate(size_t n) -> T* {
+        g_allocCount++;
+        return allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) {
+        allocator<T>().deallocate(p, n);
+    }
+
+    friend auto operator==(const CountingAllocator&, const CountingAllocator&) -> bool {
+        return true;
+    }
+};
+
+// Строка, выделения которой учитываются
+using CountedString = basic_string<char, char_traits<char>, CountingAllocator<char>>;
+
 // Генератор случайных чисел
 int getRandomInt() {
     static boost::random::random_device rd;
@@ -37,26 +74,102 @@ void bench_push_back() {
     cout << "Результат: " << timer.format() << endl;
 }
 
+// Рост через new T[cap * 2] и копирующее присваивание (прежняя стратегия Array)
+template <typename T>
+struct CopyGrowthArray {
+    T* data = allocate(1);
+    uint32_t capacity = 1;
+    uint32_t size = 0;
+
+    // new T[] не проходит через аллокатор, поэтому выделение считается здесь
+    static auto allocate(uint32_t count) -> T* {
+        g_allocCount++;
+        return new T[count];
+    }
+
+    ~CopyGrowthArray() {
+        delete[] data;
+    }
+
+    void push(const T& value) {
+        if (size + 1 > capacity) {
+            T* newData = allocate(capacity * 2);
+            for (uint32_t i = 0; i < size; i++) {
+                newData[i] = data[i];
+            }
+            delete[] data;
+            data = newData;
+            capacity *= 2;
+        }
+        data[size++] = value;
+    }
+};
+
+void bench_string_growth() {
+    cout << "\nBenchmark: MPUSH_BACK (string, рост буфера)" << endl;
+    const uint32_t count = LARGE_DATA_SIZE / 4;
+    // Строка длиннее SSO-буфера, чтобы каждая копия выделяла память
+    const CountedString payload(48, 'x');
+
+    uint64_t allocsBefore = g_allocCount;
+    boost::timer::cpu_timer timerCopy;
+    {
+        CopyGrowthArray<CountedString> arr;
+        for (uint32_t i = 0; i < count; ++i) {
+            arr.push(payload);
+        }
+    }
+    timerCopy.stop();
+    uint64_t copyAllocs = g_allocCount - allocsBefore;
+
+    allocsBefore = g_allocCount;
+    boost::timer::cpu_timer timerMove;
+    {
+        Array<CountedString, CountingAllocator<CountedString>> arr;
+        for (uint32_t i = 0; i < count; ++i) {
+            arr.MPUSH_BACK(payload);
+        }
+    }
+    timerMove.stop();
+    uint64_t moveAllocs = g_allocCount - allocsBefore;
+
+    cout << "Элементов: " << count << endl;
+    cout << "[new T[] + копирование] выделений: " << copyAllocs << ", " << timerCopy.format();
+    cout << "[сырая память + move]   выделений: " << moveAllocs << ", " << timerMove.format();
+}
+
 void bench_insert_middle() {
-    cout << "\nBenchmark: MPUSH_BY_IND" << endl;
+    cout << "\nBenchmark: MPUSH_BY_IND vs MPUSH_RANGE_BY_IND" << endl;
     cout << "Используем меньший размер данных." << endl;
-    
+    const int INSERTS = 1000;
+
     Array<int> arr;
-    // Сначала заполним массив
+    Array<int> arrBatch;
+    // Сначала заполним массивы
     for (uint32_t i = 0; i < SMALL_DATA_SIZE; ++i) {
         arr.MPUSH_BACK(i);
+        arrBatch.MPUSH_BACK(i);
+    }
+    vector<int> batch(INSERTS);
+    for (int i = 0; i < INSERTS; ++i) {
+        batch[i] = getRandomInt();
     }
 
+    // Вставляем 1000 элементов по одному всегда в середину
     boost::timer::cpu_timer timer;
-
-    // Вставляем 1000 элементов всегда в середину
-    for (int i = 0; i < 1000; ++i) {
-        arr.MPUSH_BY_IND(arr.GetSize() / 2, getRandomInt());
+    for (int i = 0; i < INSERTS; ++i) {
+        arr.MPUSH_BY_IND(arr.GetSize() / 2, batch[i]);
     }
-
     timer.stop();
-    cout << "Вставок выполнено: 1000 (в массив размером ~" << SMALL_DATA_SIZE << ")" << endl;
-    cout << "Результат: " << timer.format() << endl;
+
+    // Те же 1000 элементов одной пачкой: хвост сдвигается один раз
+    boost::timer::cpu_timer timerBatch;
+    arrBatch.MPUSH_RANGE_BY_IND(arrBatch.GetSize() / 2, batch.data(), INSERTS);
+    timerBatch.stop();
+
+    cout << "Вставок выполнено: " << INSERTS << " (в массив размером ~" << SMALL_DATA_SIZE << ")" << endl;
+    cout << "[по одному] " << timer.format();
+    cout << "[пачкой]    " << timerBatch.format();
 }
 
 void bench_access() {
@@ -82,6 +195,191 @@ void bench_access() {
     cout << "Результат: " << timer.format() << endl;
 }
 
+void bench_scan() {
+    cout << "\nBenchmark: Последовательное суммирование (scan)" << endl;
+    Array<int> arr;
+    for (uint32_t i = 0; i < LARGE_DATA_SIZE; ++i) {
+        arr.MPUSH_BACK(getRandomInt());
+    }
+    const int PASSES = 100;
+    const double megabytes = static_cast<double>(LARGE_DATA_SIZE) * sizeof(int) * PASSES / (1024.0 * 1024.0);
+
+    auto report = [megabytes](const string& name, boost::timer::cpu_timer& timer, int64_t sum) {
+        double seconds = timer.elapsed().wall / 1e9;
+        cout << name << " сумма=" << sum << ", " << megabytes / seconds << " MB/s," << timer.format();
+    };
+
+    // Цикл по operator[] с проверкой границ на каждой итерации
+    boost::timer::cpu_timer timerIndex;
+    int64_t sumIndex = 0;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+            sumIndex += arr[i];
+        }
+    }
+    timerIndex.stop();
+    report("[operator[]] ", timerIndex, sumIndex);
+
+    // Range-for по итераторам-указателям
+    boost::timer::cpu_timer timerRange;
+    int64_t sumRange = 0;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        for (int value : arr) {
+            sumRange += value;
+        }
+    }
+    timerRange.stop();
+    report("[range-for]  ", timerRange, sumRange);
+
+    // std::accumulate поверх span
+    boost::timer::cpu_timer timerSpan;
+    int64_t sumSpan = 0;
+    for (int pass = 0; pass < PASSES; ++pass) {
+        std::span<const int> view = arr.span();
+        sumSpan = accumulate(view.begin(), view.end(), sumSpan);
+    }
+    timerSpan.stop();
+    report("[span]       ", timerSpan, sumSpan);
+}
+
+void bench_simd_kernels() {
+    cout << "\nBenchmark: MFIND / MCOUNT / MMIN / MMAX / MSUM / MFILTER_RANGE vs наивный цикл" << endl;
+    const char* levelNames[] = {"Scalar", "SSE4.1", "AVX2"};
+    cout << "Набор инструкций: " << levelNames[static_cast<int>(array_simd::getLevel())] << endl;
+
+    Array<int> arr;
+    for (uint32_t i = 0; i < LARGE_DATA_SIZE; ++i) {
+        arr.MPUSH_BACK(getRandomInt());
+    }
+    // Искомого значения нет в массиве, поэтому поиск проходит его целиком
+    const int missing = -1;
+    const int PASSES = 50;
+    int64_t sink = 0;
+
+    auto run = [&](const string& name, auto&& naive, auto&& kernel) {
+        boost::timer::cpu_timer timerNaive;
+        for (int pass = 0; pass < PASSES; ++pass) {
+            sink += naive();
+        }
+        timerNaive.stop();
+        boost::timer::cpu_timer timerKernel;
+        for (int pass = 0; pass < PASSES; ++pass) {
+            sink += kernel();
+        }
+        timerKernel.stop();
+        double speedup = static_cast<double>(timerNaive.elapsed().wall) / timerKernel.elapsed().wall;
+        cout << name << " наивно: " << timerNaive.elapsed().wall / 1e6 << " ms, ядро: "
+             << timerKernel.elapsed().wall / 1e6 << " ms, ускорение x" << speedup << endl;
+    };
+
+    run("[find]  ", [&]() -> int64_t {
+        for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+            if (arr[i] == missing) return i;
+        }
+        return arr.GetSize();
+    }, [&]() -> int64_t { return arr.MFIND(missing); });
+
+    run("[count] ", [&]() -> int64_t {
+        int64_t result = 0;
+        for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+            if (arr[i] == 500) result++;
+        }
+        return result;
+    }, [&]() -> int64_t { return arr.MCOUNT(500); });
+
+    run("[min]   ", [&]() -> int64_t {
+        int result = arr[0];
+        for (uint32_t i = 1; i < arr.GetSize(); ++i) {
+            if (arr[i] < result) result = arr[i];
+        }
+        return result;
+    }, [&]() -> int64_t { return arr.MMIN(); });
+
+    run("[max]   ", [&]() -> int64_t {
+        int result = arr[0];
+        for (uint32_t i = 1; i < arr.GetSize(); ++i) {
+            if (arr[i] > result) result = arr[i];
+        }
+        return result;
+    }, [&]() -> int64_t { return arr.MMAX(); });
+
+    run("[sum]   ", [&]() -> int64_t {
+        int64_t result = 0;
+        for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+            result += arr[i];
+        }
+        return result;
+    }, [&]() -> int64_t { return arr.MSUM(); });
+
+    run("[filter]", [&]() -> int64_t {
+        Array<int> result;
+        for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+            if (arr[i] >= 25000 && arr[i] <= 75000) result.MPUSH_BACK(arr[i]);
+        }
+        return result.GetSize();
+    }, [&]() -> int64_t { return arr.MFILTER_RANGE(25000, 75000).GetSize(); });
+
+    cout << "(контрольная сумма " << sink << ")" << endl;
+}
+
+void bench_sort() {
+    cout << "\nBenchmark: MSORT (параллельное слияние) и MRADIX_SORT" << endl;
+    const uint32_t sizes[] = {1000000, 10000000, 100000000};
+    uint32_t maxThreads = thread::hardware_concurrency();
+    if (maxThreads == 0) {
+        maxThreads = 1;
+    }
+    boost::random::mt19937 gen(12345);
+
+    for (uint32_t n : sizes) {
+        Array<int> original;
+        for (uint32_t i = 0; i < n; ++i) {
+            original.MPUSH_BACK(static_cast<int>(gen()));
+        }
+        cout << "Элементов: " << n << endl;
+
+        for (uint32_t threads = 1; threads <= maxThreads; ++threads) {
+            Array<int> arr(original);
+            boost::timer::cpu_timer timer;
+            arr.MSORT(threads);
+            timer.stop();
+            cout << "  [MSORT, потоков " << threads << "] " << timer.format();
+        }
+
+        Array<int> arr(original);
+        boost::timer::cpu_timer timerRadix;
+        arr.MRADIX_SORT();
+        timerRadix.stop();
+        cout << "  [MRADIX_SORT]        " << timerRadix.format();
+    }
+}
+
+void bench_text_io() {
+    cout << "\nBenchmark: Text Save/Load (MSAVE / MLOAD)" << endl;
+    Array<int> arr;
+    for (uint32_t i = 0; i < LARGE_DATA_SIZE; ++i) {
+        arr.MPUSH_BACK(getRandomInt());
+    }
+    string filename = "bench_test.txt";
+
+    cout << "[Запись]" << endl;
+    boost::timer::cpu_timer timerSave;
+    arr.MSAVE(filename);
+    timerSave.stop();
+    cout << "  " << timerSave.format();
+    printThroughput(filename, timerSave);
+
+    cout << "[Чтение]" << endl;
+    Array<int> arrLoad;
+    boost::timer::cpu_timer timerLoad;
+    arrLoad.MLOAD(filename);
+    timerLoad.stop();
+    cout << "  " << timerLoad.format();
+    printThroughput(filename, timerLoad);
+
+    remove(filename.c_str());
+}
+
 void bench_binary_io() {
     cout << "\nBenchmark: Binary Save/Load (IO Operations)" << endl;
     Array<int> arr;
@@ -95,6 +393,7 @@ void bench_binary_io() {
     arr.MSAVE_BINARY(filename);
     timerSave.stop();
     cout << "  " << timerSave.format();
+    printThroughput(filename, timerSave);
 
     cout << "[Чтение]" << endl;
     Array<int> arrLoad;
@@ -102,19 +401,195 @@ void bench_binary_io() {
     arrLoad.MLOAD_BINARY(filename);
     timerLoad.stop();
     cout << "  " << timerLoad.format();
+    printThroughput(filename, timerLoad);
     
     // Удаляем временный файл
     remove(filename.c_str()); 
 }
 
-int main() {
+// Сброс файла из страничного кэша, чтобы следующая загрузка читала с диска
+void dropFileCache(const string& filename) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+// Время старта: загрузка и первый полный проход по данным (MSUM)
+void bench_mapped_startup() {
+    cout << "\nBenchmark: MLOAD_BINARY vs MMAP_BINARY (startup)" << endl;
+    const uint32_t count = 50000000;  // ~200 МБ
+    string filename = "bench_mmap.bin";
+    {
+        Array<int> arr;
+        arr.SetCapacity(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            arr.MPUSH_BACK(static_cast<int>(i));
+        }
+        arr.MSAVE_BINARY(filename);
+    }
+
+    volatile int64_t sink = 0;
+    auto measure = [&](const string& label, bool cold, auto load) {
+        if (cold) {
+            dropFileCache(filename);
+        }
+        Array<int> arr;
+        boost::timer::cpu_timer tLoad;
+        load(arr);
+        tLoad.stop();
+        boost::timer::cpu_timer tScan;
+        sink = arr.MSUM();
+        tScan.stop();
+        cout << "  " << label << (cold ? " (холодный кэш)" : " (тёплый кэш)") << endl;
+        cout << "    Загрузка: " << tLoad.format();
+        cout << "    Проход:   " << tScan.format();
+    };
+
+    for (bool cold : {true, false}) {
+        measure("MLOAD_BINARY", cold, [&](Array<int>& a) { a.MLOAD_BINARY(filename); });
+        measure("MMAP_BINARY по требованию", cold, [&](Array<int>& a) { a.MMAP_BINARY(filename); });
+        measure("MMAP_BINARY populate", cold,
+                [&](Array<int>& a) { a.MMAP_BINARY(filename, MapMode::ReadOnly, true); });
+    }
+
+    remove(filename.c_str());
+}
+
+// Размер на диске и скорость загрузки: MLOAD_BINARY против MLOAD_COMPRESSED
+void bench_compressed_io() {
+    cout << "\nBenchmark: сжатый бинарный формат (MSAVE_COMPRESSED / MLOAD_COMPRESSED)" << endl;
+    const uint32_t count = 50000000;  // 200 МБ данных int
+    const double rawMegabytes = static_cast<double>(count) * sizeof(int) / (1024.0 * 1024.0);
+    boost::random::mt19937 gen(42);
+    string rawFile = "bench_raw.bin";
+    string packedFile = "bench_packed.bin";
+
+    auto run = [&](const string& label, auto value) {
+        {
+            Array<int> arr;
+            arr.SetCapacity(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                arr.MPUSH_BACK(value(i));
+            }
+            arr.MSAVE_BINARY(rawFile);
+            boost::timer::cpu_timer tSave;
+            arr.MSAVE_COMPRESSED(packedFile);
+            tSave.stop();
+            cout << "  [" << label << "] сжатие: " << tSave.format();
+        }
+        double packedMegabytes = static_cast<double>(filesystem::file_size(packedFile)) / (1024.0 * 1024.0);
+        cout << "    На диске: " << rawMegabytes << " МБ -> " << packedMegabytes << " МБ ("
+             << rawMegabytes / packedMegabytes << "x)" << endl;
+
+        // Холодный кэш — чтение с диска, тёплый — только стоимость декодирования
+        for (int run = 0; run < 4; run++) {
+            int format = run % 2;
+            bool cold = run < 2;
+            if (cold) {
+                dropFileCache(format == 0 ? rawFile : packedFile);
+            }
+            Array<int> arr;
+            boost::timer::cpu_timer tLoad;
+            if (format == 0) {
+                arr.MLOAD_BINARY(rawFile);
+            } else {
+                arr.MLOAD_COMPRESSED(packedFile);
+            }
+            tLoad.stop();
+            double seconds = static_cast<double>(tLoad.elapsed().wall) / 1e9;
+            cout << "    " << (format == 0 ? "MLOAD_BINARY" : "MLOAD_COMPRESSED")
+                 << (cold ? " (холодный кэш): " : " (тёплый кэш):  ")
+                 << (seconds > 0 ? rawMegabytes / seconds : 0.0) << " МБ/с (по исходным данным)" << endl;
+        }
+    };
+
+    run("отсортированные", [](uint32_t i) { return static_cast<int>(i * 7 + i % 5); });
+    run("случайные", [&](uint32_t) { return static_cast<int>(gen()); });
+    run("узкий диапазон", [&](uint32_t) { return static_cast<int>(gen() % 1000); });
+
+    remove(rawFile.c_str());
+    remove(packedFile.c_str());
+}
+
+// Массив больше 2^32 элементов и файл больше 4 ГБ: рост без переполнения
+// вместимости и 64-битный заголовок бинарного формата. Запуск: b_array --large [байт]
+void bench_large_data(uint64_t bytes) {
+    cout << "\nBenchmark: большие данные, Array<uint8_t> на " << bytes << " байт" << endl;
+    string filename = "bench_large.bin";
+    {
+        Array<uint8_t> arr;
+        cout << "[MPUSH_BACK с ростом]" << endl;
+        boost::timer::cpu_timer tPush;
+        for (uint64_t i = 0; i < bytes; ++i) {
+            arr.MPUSH_BACK(static_cast<uint8_t>(i));
+        }
+        tPush.stop();
+        cout << "  " << tPush.format();
+        cout << "  Размер: " << arr.GetSize() << ", вместимость: " << arr.GetCapacity() << endl;
+
+        // Лишняя половина буфера после роста не нужна для записи
+        arr.shrink_to_fit();
+        cout << "[MSAVE_BINARY]" << endl;
+        boost::timer::cpu_timer tSave;
+        arr.MSAVE_BINARY(filename);
+        tSave.stop();
+        cout << "  " << tSave.format();
+        printThroughput(filename, tSave);
+    }
+
+    volatile uint64_t sink = 0;
+    {
+        cout << "[MLOAD_BINARY + MSUM]" << endl;
+        Array<uint8_t> arr;
+        boost::timer::cpu_timer tLoad;
+        arr.MLOAD_BINARY(filename);
+        sink = arr.MSUM();
+        tLoad.stop();
+        cout << "  " << tLoad.format();
+        printThroughput(filename, tLoad);
+    }
+    {
+        cout << "[MMAP_BINARY + MSUM]" << endl;
+        Array<uint8_t> arr;
+        boost::timer::cpu_timer tMap;
+        arr.MMAP_BINARY(filename);
+        sink = arr.MSUM();
+        tMap.stop();
+        cout << "  " << tMap.format();
+        printThroughput(filename, tMap);
+        cout << "  Элементов в отображении: " << arr.GetSize() << ", сумма: " << sink << endl;
+    }
+
+    remove(filename.c_str());
+}
+
+int main(int argc, char* argv[]) {
     cout << "Запуск Benchmarks для Array<T> с использованием Boost" << endl;
-    
+
+    if (argc > 1 && string(argv[1]) == "--large") {
+        try {
+            bench_large_data(argc > 2 ? stoull(argv[2]) : 5000000000ULL);
+        } catch (const exception& e) {
+            cerr << "Exception caught: " << e.what() << endl;
+        }
+        return 0;
+    }
+
     try {
         bench_push_back();
+        bench_string_growth();
         bench_access();
+        bench_scan();
+        bench_simd_kernels();
+        bench_sort();
         bench_insert_middle();
+        bench_text_io();
         bench_binary_io();
+        bench_mapped_startup();
+        bench_compressed_io();
     } catch (const exception& e) {
         cerr << "Exception caught: " << e.what() << endl;
     }
@@ -6,6 +6,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "binary_tree.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 
@@ -82,6 +83,7 @@ void bench_io() {
     tree.TSAVE(txtFile);
     timerTxtSave.stop();
     cout << "  Time: " << timerTxtSave.format();
+    printThroughput(txtFile, timerTxtSave);
 
     cout << "[Text Mode: TLOAD]" << endl;
     FullBinaryTree<int> treeLoadTxt;
@@ -89,6 +91,7 @@ void bench_io() {
     treeLoadTxt.TLOAD(txtFile);
     timerTxtLoad.stop();
     cout << "  Time: " << timerTxtLoad.format();
+    printThroughput(txtFile, timerTxtLoad);
 
 
     // BINARY MODE
@@ -97,6 +100,7 @@ void bench_io() {
     tree.TSAVE_BINARY(binFile);
     timerBinSave.stop();
     cout << "  Time: " << timerBinSave.format();
+    printThroughput(binFile, timerBinSave);
 
     cout << "[Binary Mode: TLOAD_BINARY]" << endl;
     FullBinaryTree<int> treeLoadBin;
@@ -104,6 +108,7 @@ void bench_io() {
     treeLoadBin.TLOAD_BINARY(binFile);
     timerBinLoad.stop();
     cout << "  Time: " << timerBinLoad.format();
+    printThroughput(binFile, timerBinLoad);
 
     // Очистка
     remove(txtFile.c_str());
@@ -0,0 +1,160 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <boost/timer/timer.hpp>
+#include "queue.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество замеров задержки пробуждения
+const uint32_t WAKE_SAMPLES = 2000;
+// Параметры нагрузки всплесками: всплески по BURST_SIZE элементов с паузой между ними
+uint32_t BURSTS = 400;
+const uint32_t BURST_SIZE = 1000;
+const uint32_t THREADS = 2;  // Производителей и столько же потребителей
+const size_t CAPACITY = 256;
+
+// Ограниченная Queue под мьютексом с двумя condition_variable — исходный вариант
+class CondVarQueue {
+ private:
+    mutex lock;
+    condition_variable notEmpty;
+    condition_variable notFull;
+    Queue<int64_t> queue;
+    size_t capacity;
+    bool closed = false;
+
+ public:
+    explicit CondVarQueue(size_t cap) : capacity(cap) {}
+
+    auto QPUSH(int64_t value) -> QueueStatus {
+        unique_lock<mutex> guard(lock);
+        notFull.wait(guard, [this]() { return closed || queue.GetSize() < capacity; });
+        if (closed) {
+            return QueueStatus::Closed;
+        }
+        queue.QPUSH(value);
+        notEmpty.notify_one();
+        return QueueStatus::Success;
+    }
+
+    auto QPOP(int64_t& value) -> QueueStatus {
+        unique_lock<mutex> guard(lock);
+        notEmpty.wait(guard, [this]() { return closed || !queue.empty(); });
+        if (queue.empty()) {
+            return QueueStatus::Closed;
+        }
+        value = queue.QPOP();
+        notFull.notify_one();
+        return QueueStatus::Success;
+    }
+
+    void close() {
+        lock_guard<mutex> guard(lock);
+        closed = true;
+        notEmpty.notify_all();
+        notFull.notify_all();
+    }
+};
+
+auto nowNs() -> int64_t {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Задержка пробуждения: потребитель спит на пустой очереди, производитель
+// после паузы кладёт в неё текущее время; потребитель считает разницу
+template <typename QueueType>
+void bench_wakeup(const string& name) {
+    QueueType q(CAPACITY);
+    vector<int64_t> latencies;
+    latencies.reserve(WAKE_SAMPLES);
+    thread consumer([&q, &latencies]() {
+        int64_t sent = 0;
+        while (q.QPOP(sent) == QueueStatus::Success) {
+            latencies.push_back(nowNs() - sent);
+        }
+    });
+    for (uint32_t i = 0; i < WAKE_SAMPLES; i++) {
+        this_thread::sleep_for(chrono::microseconds(200));  // Потребитель успевает уснуть
+        q.QPUSH(nowNs());
+    }
+    q.close();
+    consumer.join();
+
+    sort(latencies.begin(), latencies.end());
+    cout << "  " << name << ": медиана " << latencies[latencies.size() / 2] / 1000.0 << " мкс, 99-й перцентиль "
+         << latencies[latencies.size() * 99 / 100] / 1000.0 << " мкс" << endl;
+}
+
+// Пропускная способность при нагрузке всплесками: THREADS производителей
+// выдают всплески по BURST_SIZE элементов с паузой, THREADS потребителей
+// разбирают очередь и между всплесками засыпают
+template <typename QueueType>
+void bench_bursty(const string& name) {
+    QueueType q(CAPACITY);
+    atomic<long long> checksum{0};
+    vector<thread> producers;
+    vector<thread> consumers;
+    cpu_timer timer;
+    for (uint32_t t = 0; t < THREADS; t++) {
+        producers.emplace_back([&q]() {
+            for (uint32_t burst = 0; burst < BURSTS; burst++) {
+                for (uint32_t i = 0; i < BURST_SIZE; i++) {
+                    q.QPUSH(static_cast<int64_t>(i));
+                }
+                this_thread::sleep_for(chrono::microseconds(100));
+            }
+        });
+        consumers.emplace_back([&q, &checksum]() {
+            long long sum = 0;
+            int64_t value = 0;
+            while (q.QPOP(value) == QueueStatus::Success) {
+                sum += value;
+            }
+            checksum += sum;
+        });
+    }
+    for (thread& producer : producers) {
+        producer.join();
+    }
+    q.close();
+    for (thread& consumer : consumers) {
+        consumer.join();
+    }
+    timer.stop();
+
+    double seconds = static_cast<double>(timer.elapsed().wall) / 1e9;
+    double items = static_cast<double>(THREADS) * BURSTS * BURST_SIZE;
+    cout << "  " << name << ": " << (seconds > 0 ? items / seconds / 1e6 : 0.0) << " млн элементов/с"
+         << " (контрольная сумма " << checksum.load() << ")," << timer.format();
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        BURSTS = static_cast<uint32_t>(stoul(argv[1]));
+    }
+    cout << "Запуск Benchmarks для BlockingQueue<T>" << endl;
+    cout << "Аппаратных потоков: " << thread::hardware_concurrency() << ", вместимость: " << CAPACITY << endl;
+
+    try {
+        cout << "\nBenchmark: задержка пробуждения потребителя, замеров: " << WAKE_SAMPLES << endl;
+        bench_wakeup<CondVarQueue>("Queue + mutex + condition_variable");
+        bench_wakeup<BlockingQueue<int64_t>>("BlockingQueue");
+
+        cout << "\nBenchmark: всплески по " << BURST_SIZE << " элементов, всплесков на производителя: " << BURSTS
+             << ", производителей и потребителей по " << THREADS << endl;
+        bench_bursty<CondVarQueue>("Queue + mutex + condition_variable");
+        bench_bursty<BlockingQueue<int64_t>>("BlockingQueue");
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "ch.hpp"
+#include "bench_throughput.hpp"
 
 // Константы
 const uint32_t NUM_ELEMENTS = 10000;    // Количество элементов
@@ -37,6 +38,35 @@ vector<string> generateKeys(uint32_t count) {
     return keys;
 }
 
+// Стоимость расширений таблицы: вставка с минимального размера
+// против вставки в таблицу, заранее подготовленную под все ключи
+void bench_rehash() {
+    cout << "\nBenchmark: CuckooHash resize (rehash)" << endl;
+    const uint32_t count = 100000;
+    vector<string> keys = generateKeys(count);
+
+    cout << "[С расширениями] начальный размер 3" << endl;
+    CuckooHash<int> growing;
+    boost::timer::cpu_timer timerGrow;
+    for (uint32_t i = 0; i < count; ++i) {
+        growing.insert(keys[i], i);
+    }
+    timerGrow.stop();
+    cout << "  Time: " << timerGrow.format();
+
+    cout << "[Без расширений] начальный размер " << count * 4 + 1 << endl;
+    CuckooHash<int> presized(count * 4 + 1);
+    boost::timer::cpu_timer timerFixed;
+    for (uint32_t i = 0; i < count; ++i) {
+        presized.insert(keys[i], i);
+    }
+    timerFixed.stop();
+    cout << "  Time: " << timerFixed.format();
+
+    double rehashMs = static_cast<double>(timerGrow.elapsed().wall - timerFixed.elapsed().wall) / 1e6;
+    cout << "  Время на перехэширование: ~" << rehashMs << " мс" << endl;
+}
+
 void bench_core_operations() {
     cout << "\nBenchmark: Core Operations (Insert/Find/Remove)" << endl;
     
@@ -66,7 +96,7 @@ void bench_core_operations() {
     volatile int dummySum = 0; // Чтобы компилятор не выкинул цикл
     for (const auto& key : keys) {
         int* val = hashTable.find(key);
-        if (val) dummySum += *val;
+        if (val) dummySum = dummySum + *val;
     }
     
     timerFind.stop();
@@ -83,7 +113,7 @@ void bench_core_operations() {
     
     for (const auto& key : missingKeys) {
         int* val = hashTable.find(key);
-        if (val) dummySum += *val; // Сюда мы зайти не должны
+        if (val) dummySum = dummySum + *val; // Сюда мы зайти не должны
     }
     
     timerMiss.stop();
@@ -121,6 +151,7 @@ void bench_io() {
     ht.serialize_text(txtFile);
     tTS.stop();
     cout << tTS.format();
+    printThroughput(txtFile, tTS);
 
     // Text Load
     cout << "[Text Load]   ";
@@ -129,6 +160,7 @@ void bench_io() {
     htTxt.deserialize_text(txtFile);
     tTL.stop();
     cout << tTL.format();
+    printThroughput(txtFile, tTL);
 
     // Binary Save
     cout << "[Binary Save] ";
@@ -136,6 +168,7 @@ void bench_io() {
     ht.serialize_bin(binFile);
     tBS.stop();
     cout << tBS.format();
+    printThroughput(binFile, tBS);
 
     // Binary Load
     cout << "[Binary Load] ";
@@ -144,6 +177,7 @@ void bench_io() {
     htBin.deserialize_bin(binFile);
     tBL.stop();
     cout << tBL.format();
+    printThroughput(binFile, tBL);
 
     // Cleanup
     remove(txtFile.c_str());
@@ -154,6 +188,7 @@ int main() {
     cout << "Запуск Benchmarks для CuckooHash" << endl;
     
     try {
+        bench_rehash();
         bench_core_operations();
         bench_io();
     } catch (const exception& e) {
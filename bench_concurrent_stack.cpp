@@ -0,0 +1,83 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <boost/timer/timer.hpp>
+#include "stack.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество пар SPUSH/SPOP на поток (можно переопределить первым аргументом)
+uint32_t OPS_PER_THREAD = 1000000;
+
+// Однопоточный Stack под общим мьютексом — так его использовали рабочие потоки
+class LockedStack {
+ private:
+    mutex lock;
+    Stack<int> stack;
+
+ public:
+    void SPUSH(int value) {
+        lock_guard<mutex> guard(lock);
+        stack.SPUSH(value);
+    }
+
+    auto STRY_POP(int& value) -> bool {
+        lock_guard<mutex> guard(lock);
+        if (stack.GetSize() == 0) {
+            return false;
+        }
+        value = stack.SPOP();
+        return true;
+    }
+};
+
+// Каждый поток выполняет OPS_PER_THREAD пар "добавить, затем извлечь"
+template <typename StackType>
+void bench_threads(const string& name, uint32_t threadCount) {
+    StackType s;
+    vector<thread> threads;
+    cpu_timer timer;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&s]() {
+            int value = 0;
+            for (uint32_t i = 0; i < OPS_PER_THREAD; i++) {
+                s.SPUSH(static_cast<int>(i));
+                s.STRY_POP(value);
+            }
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    timer.stop();
+
+    double seconds = static_cast<double>(timer.elapsed().wall) / 1e9;
+    double operations = 2.0 * OPS_PER_THREAD * threadCount;
+    cout << "  " << name << ": " << (seconds > 0 ? operations / seconds / 1e6 : 0.0) << " млн оп/с,"
+         << timer.format();
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        OPS_PER_THREAD = static_cast<uint32_t>(stoul(argv[1]));
+    }
+    cout << "Запуск Benchmarks для ConcurrentStack<T>" << endl;
+    cout << "Аппаратных потоков: " << thread::hardware_concurrency()
+         << ", пар SPUSH/SPOP на поток: " << OPS_PER_THREAD << endl;
+
+    try {
+        for (uint32_t threadCount : {1u, 2u, 4u, 8u, 16u}) {
+            cout << "\nBenchmark: потоков: " << threadCount << endl;
+            bench_threads<LockedStack>("Stack + mutex", threadCount);
+            bench_threads<ConcurrentStack<int>>("ConcurrentStack", threadCount);
+            bench_threads<ConcurrentStack<int, true>>("ConcurrentStack + elimination", threadCount);
+        }
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
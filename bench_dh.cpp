@@ -6,6 +6,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "dh.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 using namespace boost::timer;
@@ -40,6 +41,35 @@ auto generateKeys(uint32_t count) -> vector<string> {
     return keys;
 }
 
+// Стоимость расширений таблицы: вставка с минимального размера
+// против вставки в таблицу, заранее подготовленную под все ключи
+void bench_rehash() {
+    cout << "\nBenchmark: DoubleHash resize (rehash)" << endl;
+    const uint32_t count = 100000;
+    vector<string> keys = generateKeys(count);
+
+    cout << "[С расширениями] начальный размер 3" << endl;
+    DoubleHash<int> growing;
+    cpu_timer timerGrow;
+    for (uint32_t i = 0; i < count; ++i) {
+        growing.insert(keys[i], i);
+    }
+    timerGrow.stop();
+    cout << "  Время: " << timerGrow.format();
+
+    cout << "[Без расширений] начальный размер " << count * 4 + 1 << endl;
+    DoubleHash<int> presized(count * 4 + 1);
+    cpu_timer timerFixed;
+    for (uint32_t i = 0; i < count; ++i) {
+        presized.insert(keys[i], i);
+    }
+    timerFixed.stop();
+    cout << "  Время: " << timerFixed.format();
+
+    double rehashMs = static_cast<double>(timerGrow.elapsed().wall - timerFixed.elapsed().wall) / 1e6;
+    cout << "  Время на перехэширование: ~" << rehashMs << " мс" << endl;
+}
+
 void bench_core_operations() {
     cout << "\nBenchmark: DoubleHash Core Operations" << endl;
     cout << "Количество элементов: " << NUM_ELEMENTS << endl;
@@ -65,7 +95,7 @@ void bench_core_operations() {
     volatile int sink = 0; // Защита от оптимизации
     for (const auto& key : keys) {
         int* val = hashTable.find(key);
-        if (val) sink += *val;
+        if (val) sink = sink + *val;
     }
     timerFind.stop();
     cout << "  Время: " << timerFind.format();
@@ -81,7 +111,7 @@ void bench_core_operations() {
     cpu_timer timerMiss;
     for (const auto& key : missingKeys) {
         int* val = hashTable.find(key);
-        if (val) sink += *val;
+        if (val) sink = sink + *val;
     }
     timerMiss.stop();
     cout << "  Время: " << timerMiss.format();
@@ -117,6 +147,7 @@ void bench_io_operations() {
     ht.serialize_text(txtFile);
     tTS.stop();
     cout << tTS.format();
+    printThroughput(txtFile, tTS);
 
     //TEXT LOAD
     // Чтение текстового файла медленное из-за парсинга строк >> int
@@ -126,6 +157,7 @@ void bench_io_operations() {
     htTxt.deserialize_text(txtFile);
     tTL.stop();
     cout << tTL.format();
+    printThroughput(txtFile, tTL);
 
     //BINARY SAVE
     cout << "[Binary Save] ";
@@ -133,6 +165,7 @@ void bench_io_operations() {
     ht.serialize_bin(binFile);
     tBS.stop();
     cout << tBS.format();
+    printThroughput(binFile, tBS);
 
     //BINARY LOAD
     // Должно быть значительно быстрее, так как читаются сырые байты
@@ -142,6 +175,7 @@ void bench_io_operations() {
     htBin.deserialize_bin(binFile);
     tBL.stop();
     cout << tBL.format();
+    printThroughput(binFile, tBL);
 
     // Удаление временных файлов
     remove(txtFile.c_str());
@@ -153,6 +187,7 @@ int main() {
     cout << "Запуск Benchmarks для DoubleHash (Double Hashing)" << endl;
     
     try {
+        bench_rehash();
         bench_core_operations();
         bench_io_operations();
     } catch (const exception& e) {
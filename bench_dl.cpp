@@ -6,6 +6,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "doubly_list.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 using namespace boost::timer;
@@ -88,7 +89,7 @@ void bench_search() {
     for (int i = 0; i < 1000; ++i) {
         int target = getRandomInt() % NUM_ELEMENTS; 
         if (list.LGET_BY_VALUE(target) != nullptr) {
-            foundCount++;
+            foundCount = foundCount + 1;
         }
     }
     timerSearch.stop();
@@ -113,6 +114,7 @@ void bench_io() {
     list.LSAVE(txtFile);
     tTS.stop();
     cout << tTS.format();
+    printThroughput(txtFile, tTS);
 
     cout << "[Text Load]   ";
     DoublyList<int> listTxt;
@@ -120,6 +122,7 @@ void bench_io() {
     listTxt.LLOAD(txtFile);
     tTL.stop();
     cout << tTL.format();
+    printThroughput(txtFile, tTL);
 
     // BINARY
     cout << "[Binary Save] ";
@@ -127,6 +130,7 @@ void bench_io() {
     list.LSAVE_BIN(binFile);
     tBS.stop();
     cout << tBS.format();
+    printThroughput(binFile, tBS);
 
     cout << "[Binary Load] ";
     DoublyList<int> listBin;
@@ -134,6 +138,7 @@ void bench_io() {
     listBin.LLOAD_BIN(binFile);
     tBL.stop();
     cout << tBL.format();
+    printThroughput(binFile, tBL);
 
     // Cleanup
     remove(txtFile.c_str());
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <boost/timer/timer.hpp>
+#include <boost/random.hpp>
+#include "array.hpp"
+#include "gap_buffer.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Размер документа и количество правок
+const uint32_t DOCUMENT_SIZE = 1000000;
+const uint32_t NUM_EDITS = 200000;
+
+// Одна правка трассы: вставка или удаление по индексу
+struct Edit {
+    bool insert;
+    uint32_t index;
+    char value;
+};
+
+// Трасса редактирования: курсор блуждает небольшими шагами,
+// изредка перескакивая в случайное место документа
+auto generateTrace() -> vector<Edit> {
+    boost::random::mt19937 gen(2024);
+    boost::random::uniform_int_distribution<int> step(-8, 8);
+    boost::random::uniform_int_distribution<int> percent(0, 99);
+    vector<Edit> trace;
+    trace.reserve(NUM_EDITS);
+
+    uint32_t size = DOCUMENT_SIZE;
+    int64_t cursor = size / 2;
+    for (uint32_t i = 0; i < NUM_EDITS; ++i) {
+        if (percent(gen) == 0) {
+            cursor = boost::random::uniform_int_distribution<uint32_t>(0, size)(gen);
+        }
+        cursor += step(gen);
+        cursor = cursor < 0 ? 0 : (cursor > size ? size : cursor);
+
+        // 80% вставок, 20% удалений
+        if (percent(gen) < 80 || size == 0) {
+            trace.push_back({true, static_cast<uint32_t>(cursor), static_cast<char>('a' + i % 26)});
+            size++;
+            cursor++;
+        } else {
+            if (cursor == size) {
+                cursor--;
+            }
+            trace.push_back({false, static_cast<uint32_t>(cursor), 0});
+            size--;
+        }
+    }
+    return trace;
+}
+
+void bench_editing_trace() {
+    cout << "\nBenchmark: трасса локальных правок" << endl;
+    cout << "Размер документа: " << DOCUMENT_SIZE << ", правок: " << NUM_EDITS << endl;
+    vector<Edit> trace = generateTrace();
+
+    Array<char> arr;
+    GapBuffer<char> gb;
+    for (uint32_t i = 0; i < DOCUMENT_SIZE; ++i) {
+        arr.MPUSH_BACK(static_cast<char>('a' + i % 26));
+        gb.GPUSH_BACK(static_cast<char>('a' + i % 26));
+    }
+
+    cout << "[Array MPUSH_BY_IND / MDEL_BY_IND]" << endl;
+    cpu_timer timerArray;
+    for (const Edit& e : trace) {
+        if (e.insert) {
+            arr.MPUSH_BY_IND(e.index, e.value);
+        } else {
+            arr.MDEL_BY_IND(e.index);
+        }
+    }
+    timerArray.stop();
+    cout << "  Время: " << timerArray.format();
+
+    cout << "[GapBuffer GPUSH_BY_IND / GDEL_BY_IND]" << endl;
+    cpu_timer timerGap;
+    for (const Edit& e : trace) {
+        if (e.insert) {
+            gb.GPUSH_BY_IND(e.index, e.value);
+        } else {
+            gb.GDEL_BY_IND(e.index);
+        }
+    }
+    timerGap.stop();
+    cout << "  Время: " << timerGap.format();
+
+    // Последовательное чтение после правок
+    cout << "[Чтение по индексу]" << endl;
+    int64_t sumArray = 0;
+    int64_t sumGap = 0;
+    cpu_timer timerReadArray;
+    for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+        sumArray += arr.MGET_UNCHECKED(i);
+    }
+    timerReadArray.stop();
+    cpu_timer timerReadGap;
+    for (uint32_t i = 0; i < gb.GetSize(); ++i) {
+        sumGap += gb.GGET_UNCHECKED(i);
+    }
+    timerReadGap.stop();
+    cout << "  Array:     " << timerReadArray.format();
+    cout << "  GapBuffer: " << timerReadGap.format();
+    cout << "  Совпадение содержимого: " << (sumArray == sumGap ? "да" : "нет")
+         << " (контрольная сумма " << sumGap << ")" << endl;
+}
+
+int main() {
+    cout << "Запуск Benchmarks для GapBuffer<T>" << endl;
+
+    try {
+        bench_editing_trace();
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <unistd.h>
+#include <boost/timer/timer.hpp>
+#include "array.hpp"
+#include "stack.hpp"
+#include "queue.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество элементов во всплеске (можно переопределить первым аргументом)
+uint32_t NUM_ELEMENTS = 50000000;
+
+// Текущий размер резидентной памяти процесса (МБ) по /proc/self/statm
+auto residentMb() -> double {
+    ifstream statm("/proc/self/statm");
+    uint64_t totalPages = 0;
+    uint64_t residentPages = 0;
+    statm >> totalPages >> residentPages;
+    return static_cast<double>(residentPages) * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+}
+
+void printRss(const string& stage, double baseline) {
+    cout << "  " << stage << ": " << residentMb() - baseline << " МБ" << endl;
+}
+
+// Всплеск и опустошение: контейнер заполняется до NUM_ELEMENTS и почти
+// полностью опустошается. Без политики буфер остаётся на пике, с политикой
+// ShrinkPolicy::Quarter() сжимается по ходу извлечения
+template <typename Container, typename Push, typename Pop>
+void bench_burst(const string& name, bool withPolicy, Push push, Pop pop) {
+    cout << "[" << name << (withPolicy ? ", ShrinkPolicy::Quarter()" : ", без политики") << "]" << endl;
+    double baseline = residentMb();
+    {
+        Container c;
+        if (withPolicy) {
+            c.SetShrinkPolicy(ShrinkPolicy::Quarter());
+        }
+        cpu_timer timer;
+        for (uint32_t i = 0; i < NUM_ELEMENTS; i++) {
+            push(c, static_cast<int>(i));
+        }
+        printRss("Пик", baseline);
+        for (uint32_t i = 0; i < NUM_ELEMENTS - 1000; i++) {
+            pop(c);
+        }
+        timer.stop();
+        printRss("После опустошения", baseline);
+        c.shrink_to_fit();
+        printRss("После shrink_to_fit", baseline);
+        cout << "  Время: " << timer.format();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        NUM_ELEMENTS = static_cast<uint32_t>(stoul(argv[1]));
+    }
+    cout << "Запуск Benchmarks потребления памяти (RSS)" << endl;
+    cout << "\nBenchmark: всплеск и опустошение, элементов: " << NUM_ELEMENTS << endl;
+
+    try {
+        for (bool withPolicy : {false, true}) {
+            bench_burst<Stack<int>>("Stack", withPolicy,
+                                    [](Stack<int>& s, int v) { s.SPUSH(v); },
+                                    [](Stack<int>& s) { s.SPOP(); });
+            bench_burst<Queue<int>>("Queue", withPolicy,
+                                    [](Queue<int>& q, int v) { q.QPUSH(v); },
+                                    [](Queue<int>& q) { q.QPOP(); });
+            bench_burst<Array<int>>("Array", withPolicy,
+                                    [](Array<int>& a, int v) { a.MPUSH_BACK(v); },
+                                    [](Array<int>& a) { a.MDEL_BY_IND(a.GetSize() - 1); });
+        }
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <boost/timer/timer.hpp>
+#include "queue.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Общее количество передаваемых элементов (можно переопределить первым аргументом)
+uint32_t NUM_ELEMENTS = 4000000;
+const size_t RING_CAPACITY = 4096;
+
+// Однопоточная Queue под мьютексом; ожидание — уступка процессора
+class LockedQueue {
+ private:
+    mutex lock;
+    Queue<int> queue;
+
+ public:
+    void QPUSH(int value) {
+        lock_guard<mutex> guard(lock);
+        queue.QPUSH(value);
+    }
+
+    auto QPOP() -> int {
+        while (true) {
+            {
+                lock_guard<mutex> guard(lock);
+                if (!queue.empty()) {
+                    return queue.QPOP();
+                }
+            }
+            this_thread::yield();
+        }
+    }
+};
+
+// threadCount производителей и threadCount потребителей делят NUM_ELEMENTS поровну
+template <typename QueueType>
+void bench_threads(const string& name, QueueType& q, uint32_t threadCount) {
+    const uint32_t perThread = NUM_ELEMENTS / threadCount;
+    atomic<long long> checksum{0};
+    vector<thread> threads;
+    cpu_timer timer;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        threads.emplace_back([&q, perThread, t]() {
+            for (uint32_t i = 0; i < perThread; i++) {
+                q.QPUSH(static_cast<int>(t * perThread + i));
+            }
+        });
+        threads.emplace_back([&q, &checksum, perThread]() {
+            long long sum = 0;
+            for (uint32_t i = 0; i < perThread; i++) {
+                sum += q.QPOP();
+            }
+            checksum += sum;
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    timer.stop();
+
+    double seconds = static_cast<double>(timer.elapsed().wall) / 1e9;
+    double items = static_cast<double>(perThread) * threadCount;
+    cout << "  " << name << ": " << (seconds > 0 ? items / seconds / 1e6 : 0.0) << " млн элементов/с"
+         << " (контрольная сумма " << checksum.load() << ")" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        NUM_ELEMENTS = static_cast<uint32_t>(stoul(argv[1]));
+    }
+    uint32_t hardware = max(1u, thread::hardware_concurrency());
+    cout << "Запуск Benchmarks для MpmcQueue<T>" << endl;
+    cout << "Аппаратных потоков: " << hardware << ", элементов: " << NUM_ELEMENTS << endl;
+
+    try {
+        // Производителей (и столько же потребителей) от 1 до 2N
+        vector<uint32_t> counts;
+        for (uint32_t count = 1; count < 2 * hardware; count *= 2) {
+            counts.push_back(count);
+        }
+        counts.push_back(2 * hardware);
+        for (uint32_t threadCount : counts) {
+            cout << "\nBenchmark: производителей и потребителей по " << threadCount << endl;
+            {
+                LockedQueue q;
+                bench_threads("Queue + mutex", q, threadCount);
+            }
+            {
+                MpmcQueue<int> q(RING_CAPACITY);
+                bench_threads("MpmcQueue", q, threadCount);
+            }
+        }
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <boost/timer/timer.hpp>
+#include <boost/random.hpp>
+#include "array.hpp"
+#include "priority_queue.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество элементов для сравнения с отсортированным Array (вставка O(n))
+const uint32_t SORTED_DATA_SIZE = 100000;
+// Количество элементов для сравнения арностей кучи между собой
+const uint32_t HEAP_DATA_SIZE = 2000000;
+
+auto randomValues(uint32_t count) -> vector<int> {
+    boost::random::mt19937 rng(12345);
+    boost::random::uniform_int_distribution<int> dist(0, 1000000000);
+    vector<int> values(count);
+    for (uint32_t i = 0; i < count; i++) {
+        values[i] = dist(rng);
+    }
+    return values;
+}
+
+// Эмуляция очереди с приоритетом отсортированным Array: точка вставки
+// ищется бинарным поиском, MPUSH_BY_IND сдвигает хвост, вершина — последний элемент
+auto sortedArrayRun(const vector<int>& values) -> int64_t {
+    Array<int> arr;
+    for (int value : values) {
+        size_t index = static_cast<size_t>(lower_bound(arr.begin(), arr.end(), value) - arr.begin());
+        arr.MPUSH_BY_IND(index, value);
+    }
+    int64_t checksum = 0;
+    while (arr.GetSize() > 0) {
+        checksum += arr.MGET_UNCHECKED(arr.GetSize() - 1);
+        arr.MDEL_BY_IND(arr.GetSize() - 1);
+    }
+    return checksum;
+}
+
+template <uint32_t Arity>
+auto heapRun(const vector<int>& values) -> int64_t {
+    PriorityQueue<int, less<int>, Arity> pq;
+    for (int value : values) {
+        pq.PPUSH(value);
+    }
+    int64_t checksum = 0;
+    while (!pq.empty()) {
+        checksum += pq.PPOP();
+    }
+    return checksum;
+}
+
+template <typename Run>
+void timeRun(const string& name, Run run) {
+    cpu_timer timer;
+    int64_t checksum = run();
+    timer.stop();
+    cout << "  " << name << " (контрольная сумма " << checksum << "):" << timer.format();
+}
+
+void bench_sorted_array() {
+    cout << "\nBenchmark: PPUSH + PPOP против отсортированного Array (MPUSH_BY_IND), элементов: "
+         << SORTED_DATA_SIZE << endl;
+    vector<int> values = randomValues(SORTED_DATA_SIZE);
+    timeRun("Отсортированный Array", [&] { return sortedArrayRun(values); });
+    timeRun("PriorityQueue, арность 2", [&] { return heapRun<2>(values); });
+    timeRun("PriorityQueue, арность 4", [&] { return heapRun<4>(values); });
+    timeRun("PriorityQueue, арность 8", [&] { return heapRun<8>(values); });
+}
+
+void bench_arity() {
+    cout << "\nBenchmark: арность кучи, PPUSH + PPOP, элементов: " << HEAP_DATA_SIZE << endl;
+    vector<int> values = randomValues(HEAP_DATA_SIZE);
+    timeRun("Арность 2", [&] { return heapRun<2>(values); });
+    timeRun("Арность 4", [&] { return heapRun<4>(values); });
+    timeRun("Арность 8", [&] { return heapRun<8>(values); });
+}
+
+// Построение кучи из Array за O(n) против HEAP_DATA_SIZE вызовов PPUSH
+template <uint32_t Arity>
+void heapifyRun(const Array<int>& values) {
+    cpu_timer timerPush;
+    PriorityQueue<int, less<int>, Arity> pushed;
+    for (int value : values) {
+        pushed.PPUSH(value);
+    }
+    timerPush.stop();
+
+    cpu_timer timerHeapify;
+    PriorityQueue<int, less<int>, Arity> built(values);
+    timerHeapify.stop();
+
+    cout << "  [арность " << Arity << ", PPUSH по одному] вершина " << pushed.PTOP() << "," << timerPush.format();
+    cout << "  [арность " << Arity << ", из Array]        вершина " << built.PTOP() << "," << timerHeapify.format();
+}
+
+void bench_heapify() {
+    cout << "\nBenchmark: построение кучи, элементов: " << HEAP_DATA_SIZE << endl;
+    Array<int> values;
+    for (int value : randomValues(HEAP_DATA_SIZE)) {
+        values.MPUSH_BACK(value);
+    }
+    heapifyRun<2>(values);
+    heapifyRun<4>(values);
+    heapifyRun<8>(values);
+}
+
+// Нагрузка как в алгоритме Дейкстры: min-куча из HEAP_DATA_SIZE / 4 элементов,
+// на каждый PPOP приходится несколько PUPDATE с уменьшением ключа
+template <uint32_t Arity>
+void decreaseKeyRun(const vector<int>& values) {
+    uint32_t count = HEAP_DATA_SIZE / 4;
+    PriorityQueue<int, greater<int>, Arity> pq(span<const int>(values.data(), count));
+    cpu_timer timer;
+    int64_t checksum = 0;
+    uint32_t cursor = count;
+    while (!pq.empty()) {
+        checksum += pq.PPOP();
+        for (uint32_t k = 0; k < 3 && !pq.empty(); k++) {
+            size_t handle = values[cursor++ % values.size()] % count;
+            if (pq.PCONTAINS(handle)) {
+                int current = pq.PGET(handle);
+                pq.PUPDATE(handle, current - current / 4);
+            }
+        }
+    }
+    timer.stop();
+    cout << "  Арность " << Arity << " (контрольная сумма " << checksum << "):" << timer.format();
+}
+
+void bench_decrease_key() {
+    cout << "\nBenchmark: PPOP + PUPDATE (decrease-key), элементов: " << HEAP_DATA_SIZE / 4 << endl;
+    vector<int> values = randomValues(HEAP_DATA_SIZE);
+    decreaseKeyRun<2>(values);
+    decreaseKeyRun<4>(values);
+    decreaseKeyRun<8>(values);
+}
+
+int main() {
+    cout << "Запуск Benchmarks для PriorityQueue<T>" << endl;
+
+    try {
+        bench_sorted_array();
+        bench_arity();
+        bench_heapify();
+        bench_decrease_key();
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
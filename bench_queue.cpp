@@ -2,10 +2,13 @@
 #include <vector>
 #include <string>
 #include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
 #include <boost/timer/timer.hpp>
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "queue.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 using namespace boost::timer;
@@ -41,25 +44,109 @@ void bench_growth_drain() {
 
 void bench_circular_buffer() {
     cout << "\nBenchmark: Circular Buffer Logic (Ping-Pong)" << endl;
-    cout << "Сценарий: Очередь держится на размере ~5000, но индексы двигаются." << endl;
-    
-    // Предзаполняем очередь, чтобы она не была пустой
-    Queue<int> q;
-    const int STABLE_SIZE = 5000;
-    for (int i = 0; i < STABLE_SIZE; ++i) q.QPUSH(i);
+    cout << "Сценарий: размер очереди постоянный, но индексы двигаются." << endl;
 
-    // Замеряем сценарий "Постоянный поток": 
-    // Пришел пакет -> Обработан пакет. Размер не меняется, но массив прокручивается.
-    cpu_timer timerCircle;
-    
-    for (uint32_t i = 0; i < NUM_OPS; ++i) {
-        q.QPUSH(i); // Хвост сдвинулся
-        q.QPOP();   // Голова сдвинулась
+    // Размеры выбраны не степенями двойки: буфер округляется вверх,
+    // и голова с хвостом регулярно переходят через конец массива
+    for (int stableSize : {3, 5000, 1000000}) {
+        // Предзаполняем очередь, чтобы она не была пустой
+        Queue<int> q;
+        for (int i = 0; i < stableSize; ++i) q.QPUSH(i);
+
+        // Замеряем сценарий "Постоянный поток":
+        // Пришел пакет -> Обработан пакет. Размер не меняется, но массив прокручивается.
+        long long sum = 0;
+        cpu_timer timerCircle;
+        for (uint32_t i = 0; i < NUM_OPS; ++i) {
+            q.QPUSH(i);      // Хвост сдвинулся
+            sum += q.QPOP(); // Голова сдвинулась
+        }
+        timerCircle.stop();
+
+        double nanoseconds = static_cast<double>(timerCircle.elapsed().wall) / NUM_OPS;
+        cout << "[Размер " << stableSize << ", вместимость " << q.GetCapacity() << "]" << endl;
+        cout << "  Итераций: " << NUM_OPS << ", " << nanoseconds << " нс на пару QPUSH/QPOP"
+             << " (контрольная сумма " << sum << ")" << endl;
+        cout << "  Время: " << timerCircle.format();
+    }
+}
+
+// Строки длиннее буфера SSO: каждая копия строки — выделение памяти в куче
+void bench_string_payload() {
+    const uint32_t count = NUM_OPS / 4;
+    const string payload(40, 'q');
+    cout << "\nBenchmark: Queue<string>, строки по " << payload.size() << " символов, " << count << " штук" << endl;
+
+    Queue<string> q;
+    cpu_timer timerPush;
+    for (uint32_t i = 0; i < count; ++i) {
+        string value = payload;
+        q.QPUSH(std::move(value));
+    }
+    timerPush.stop();
+    cout << "  [QPUSH(std::move)] Время: " << timerPush.format();
+
+    size_t totalLength = 0;
+    cpu_timer timerPop;
+    for (uint32_t i = 0; i < count; ++i) {
+        totalLength += q.QGET().size();
+        string value = q.QPOP();
+        totalLength += value.size();
+    }
+    timerPop.stop();
+    cout << "  [QGET + QPOP] Время: " << timerPop.format();
+
+    cpu_timer timerEmplace;
+    for (uint32_t i = 0; i < count; ++i) {
+        q.QEMPLACE(payload.size(), 'q');
+    }
+    timerEmplace.stop();
+    cout << "  [QEMPLACE] Время: " << timerEmplace.format();
+    cout << "  Контрольная сумма длин: " << totalLength << endl;
+}
+
+// Пакетная передача: пакет из batch элементов добавляется и сразу
+// извлекается, всего NUM_OPS элементов. Сравниваются поэлементные QPUSH/QPOP и
+// пакетные QPUSH_BATCH/QPOP_BATCH
+void bench_batch() {
+    cout << "\nBenchmark: пакетные QPUSH/QPOP, элементов: " << NUM_OPS << endl;
+    for (uint32_t batch : {1u, 16u, 256u, 4096u}) {
+        vector<int> items(batch);
+        vector<int> out(batch);
+        for (uint32_t i = 0; i < batch; ++i) {
+            items[i] = static_cast<int>(i);
+        }
+        const uint32_t rounds = NUM_OPS / batch;
+        const double total = static_cast<double>(rounds) * batch;
+        long long sum = 0;
+        cout << "[Пакет " << batch << "]" << endl;
+
+        Queue<int> c;
+        cpu_timer timerSingle;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            for (uint32_t i = 0; i < batch; ++i) {
+                c.QPUSH(items[i]);
+            }
+            for (uint32_t i = 0; i < batch; ++i) {
+                out[i] = c.QPOP();
+            }
+            sum += out[batch - 1];
+        }
+        timerSingle.stop();
+        double seconds = static_cast<double>(timerSingle.elapsed().wall) / 1e9;
+        cout << "  QPUSH/QPOP: " << (seconds > 0 ? total / seconds / 1e6 : 0.0) << " млн элементов/с" << endl;
+
+        cpu_timer timerBatch;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            c.QPUSH_BATCH(items);
+            c.QPOP_BATCH(out);
+            sum += out[batch - 1];
+        }
+        timerBatch.stop();
+        seconds = static_cast<double>(timerBatch.elapsed().wall) / 1e9;
+        cout << "  QPUSH_BATCH/QPOP_BATCH: " << (seconds > 0 ? total / seconds / 1e6 : 0.0) << " млн элементов/с"
+             << " (контрольная сумма " << sum << ")" << endl;
     }
-    
-    timerCircle.stop();
-    cout << "  Итераций: " << NUM_OPS << endl;
-    cout << "  Время: " << timerCircle.format();
 }
 
 void bench_io() {
@@ -79,6 +166,7 @@ void bench_io() {
     q.QSAVE(txtFile);
     tTS.stop();
     cout << tTS.format();
+    printThroughput(txtFile, tTS);
 
     // TEXT LOAD
     cout << "[Text Load]   ";
@@ -87,6 +175,7 @@ void bench_io() {
     qTxt.QLOAD(txtFile);
     tTL.stop();
     cout << tTL.format();
+    printThroughput(txtFile, tTL);
 
     // BINARY SAVE
     cout << "[Binary Save] ";
@@ -94,6 +183,7 @@ void bench_io() {
     q.QSAVE_BINARY(binFile);
     tBS.stop();
     cout << tBS.format();
+    printThroughput(binFile, tBS);
 
     // BINARY LOAD
     cout << "[Binary Load] ";
@@ -102,12 +192,58 @@ void bench_io() {
     qBin.QLOAD_BINARY(binFile);
     tBL.stop();
     cout << tBL.format();
+    printThroughput(binFile, tBL);
 
     // Удаление файлов
     remove(txtFile.c_str());
     remove(binFile.c_str());
 }
 
+// Крупный бинарный файл: кольцо "свёрнуто", поэтому сохранение идёт двумя
+// участками; загрузка — одним чтением, потоковое добавление — блоками из дескриптора
+void bench_binary_bulk() {
+    const uint32_t BULK_SIZE = 20000000;
+    cout << "\nBenchmark: Bulk Binary I/O, элементов: " << BULK_SIZE << endl;
+
+    Queue<int> q;
+    for (uint32_t i = 0; i < BULK_SIZE; ++i) q.QPUSH(i);
+    for (uint32_t i = 0; i < BULK_SIZE / 4; ++i) q.QPOP();
+    for (uint32_t i = 0; i < BULK_SIZE / 4; ++i) q.QPUSH(i);  // Хвост в начале буфера
+
+    string binFile = "queue_bench_bulk.bin";
+
+    cout << "[QSAVE_BINARY] ";
+    cpu_timer tSave;
+    q.QSAVE_BINARY(binFile);
+    tSave.stop();
+    cout << tSave.format();
+    printThroughput(binFile, tSave);
+
+    cout << "[QLOAD_BINARY] ";
+    Queue<int> loaded;
+    cpu_timer tLoad;
+    loaded.QLOAD_BINARY(binFile);
+    tLoad.stop();
+    cout << tLoad.format();
+    printThroughput(binFile, tLoad);
+
+    cout << "[QPUSH_FD]     ";
+    Queue<int> streamed;
+    cpu_timer tStream;
+    int fd = open(binFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw runtime_error("Error opening file for streaming: " + binFile);
+    }
+    lseek(fd, static_cast<off_t>(binary_format::headerBytes), SEEK_SET);
+    size_t pushed = streamed.QPUSH_FD(fd);
+    close(fd);
+    tStream.stop();
+    cout << "Элементов: " << pushed << endl << "  " << tStream.format();
+    printThroughput(binFile, tStream);
+
+    remove(binFile.c_str());
+}
+
 int main() {
     setlocale(LC_ALL, "");
     cout << "Запуск Benchmarks для Queue" << endl;
@@ -115,7 +251,10 @@ int main() {
     try {
         bench_growth_drain();
         bench_circular_buffer();
+        bench_string_payload();
+        bench_batch();
         bench_io();
+        bench_binary_bulk();
     } catch (const exception& e) {
         cerr << "CRITICAL ERROR: " << e.what() << endl;
     }
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+#include <boost/timer/timer.hpp>
+#include "array.hpp"
+#include "segmented_array.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество элементов (можно переопределить первым аргументом)
+uint64_t NUM_ELEMENTS = 100000000;
+
+// Гистограмма задержек с шагом 10 нс до 100 мкс; максимум хранится точно
+class LatencyHistogram {
+ private:
+    static constexpr uint64_t bucketNs = 10;
+    static constexpr size_t bucketCount = 10000;
+    vector<uint64_t> buckets;
+    uint64_t overflow;
+    uint64_t total;
+    uint64_t maxNs;
+
+ public:
+    LatencyHistogram() : buckets(bucketCount, 0), overflow(0), total(0), maxNs(0) {}
+
+    void add(uint64_t ns) {
+        size_t bucket = ns / bucketNs;
+        if (bucket < bucketCount) {
+            buckets[bucket]++;
+        } else {
+            overflow++;
+        }
+        if (ns > maxNs) {
+            maxNs = ns;
+        }
+        total++;
+    }
+
+    // Верхняя граница перцентиля p (в нс) с точностью до шага гистограммы
+    [[nodiscard]] auto percentile(double p) const -> uint64_t {
+        uint64_t target = static_cast<uint64_t>(p * static_cast<double>(total));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucketCount; i++) {
+            seen += buckets[i];
+            if (seen > target) {
+                return (i + 1) * bucketNs;
+            }
+        }
+        return maxNs;
+    }
+
+    [[nodiscard]] auto max() const -> uint64_t {
+        return maxNs;
+    }
+};
+
+// Замер задержки каждого MPUSH_BACK
+template <typename Container>
+void bench_push_latency(const string& name) {
+    cout << "[" << name << "]" << endl;
+    Container arr;
+    LatencyHistogram histogram;
+
+    cpu_timer timer;
+    for (uint64_t i = 0; i < NUM_ELEMENTS; i++) {
+        auto start = chrono::steady_clock::now();
+        arr.MPUSH_BACK(static_cast<int>(i));
+        auto stop = chrono::steady_clock::now();
+        histogram.add(static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(stop - start).count()));
+    }
+    timer.stop();
+
+    cout << "  Общее время: " << timer.format();
+    cout << "  p50: " << histogram.percentile(0.50) << " нс, p99: " << histogram.percentile(0.99)
+         << " нс, p99.99: " << histogram.percentile(0.9999) << " нс, max: "
+         << histogram.max() / 1000 << " мкс" << endl;
+    cout << "  Вместимость: " << arr.GetCapacity() << " элементов" << endl;
+}
+
+// Последовательный проход по индексам: цена пересчёта индекса в блок
+template <typename Container>
+void bench_indexed_scan(const string& name) {
+    const uint32_t count = 10000000;
+    Container arr;
+    for (uint32_t i = 0; i < count; i++) {
+        arr.MPUSH_BACK(static_cast<int>(i));
+    }
+
+    int64_t sum = 0;
+    cpu_timer timer;
+    for (uint32_t i = 0; i < count; i++) {
+        sum += arr.MGET_UNCHECKED(i);
+    }
+    timer.stop();
+    cout << "  " << name << " (контрольная сумма " << sum << "):" << timer.format();
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        NUM_ELEMENTS = stoull(argv[1]);
+    }
+    cout << "Запуск Benchmarks для SegmentedArray<T>" << endl;
+    cout << "\nBenchmark: задержка MPUSH_BACK, элементов: " << NUM_ELEMENTS << endl;
+
+    try {
+        bench_push_latency<Array<int>>("Array");
+        bench_push_latency<SegmentedArray<int>>("SegmentedArray");
+
+        cout << "\nBenchmark: последовательный доступ по индексу (1e7)" << endl;
+        bench_indexed_scan<Array<int>>("Array");
+        bench_indexed_scan<SegmentedArray<int>>("SegmentedArray");
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
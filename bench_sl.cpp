@@ -6,6 +6,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "singly_list.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 using namespace boost::timer;
@@ -127,6 +128,7 @@ void bench_io() {
     list.FSAVE(txtFile);
     tTS.stop();
     cout << tTS.format();
+    printThroughput(txtFile, tTS);
 
     // TEXT LOAD
     cout << "[Text Load]   ";
@@ -135,6 +137,7 @@ void bench_io() {
     listTxt.FLOAD(txtFile);
     tTL.stop();
     cout << tTL.format();
+    printThroughput(txtFile, tTL);
 
     // BINARY SAVE
     cout << "[Binary Save] ";
@@ -142,6 +145,7 @@ void bench_io() {
     list.FSERIALIZE(binFile);
     tBS.stop();
     cout << tBS.format();
+    printThroughput(binFile, tBS);
 
     // BINARY LOAD
     cout << "[Binary Load] ";
@@ -150,6 +154,7 @@ void bench_io() {
     listBin.FDESERIALIZE(binFile);
     tBL.stop();
     cout << tBL.format();
+    printThroughput(binFile, tBL);
 
     // Удаление файлов
     remove(txtFile.c_str());
@@ -0,0 +1,180 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <boost/timer/timer.hpp>
+#include "queue.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Количество передаваемых элементов (можно переопределить первым аргументом)
+uint32_t NUM_ELEMENTS = 10000000;
+// Количество обменов в тесте задержки
+const uint32_t ROUND_TRIPS = 200000;
+const size_t RING_CAPACITY = 4096;
+const size_t BATCH = 64;
+
+// Однопоточная Queue под мьютексом — так очередь передавали между потоками
+class LockedQueue {
+ private:
+    mutex lock;
+    Queue<int> queue;
+
+ public:
+    auto QTRY_PUSH(int value) -> bool {
+        lock_guard<mutex> guard(lock);
+        queue.QPUSH(value);
+        return true;
+    }
+
+    auto QTRY_POP(int& value) -> bool {
+        lock_guard<mutex> guard(lock);
+        if (queue.empty()) {
+            return false;
+        }
+        value = queue.QPOP();
+        return true;
+    }
+};
+
+void printThroughput(const string& name, const cpu_timer& timer, long long checksum) {
+    double seconds = static_cast<double>(timer.elapsed().wall) / 1e9;
+    cout << "  " << name << ": " << (seconds > 0 ? NUM_ELEMENTS / seconds / 1e6 : 0.0) << " млн элементов/с"
+         << " (контрольная сумма " << checksum << ")" << endl;
+}
+
+// Пропускная способность: производитель передаёт NUM_ELEMENTS чисел потребителю.
+// При неудаче поток уступает процессор, чтобы тест работал и на одном ядре
+template <typename QueueType>
+void bench_throughput(const string& name, QueueType& q) {
+    long long sum = 0;
+    cpu_timer timer;
+    thread producer([&q]() {
+        for (uint32_t i = 0; i < NUM_ELEMENTS; i++) {
+            while (!q.QTRY_PUSH(static_cast<int>(i))) {
+                this_thread::yield();
+            }
+        }
+    });
+    int value = 0;
+    for (uint32_t i = 0; i < NUM_ELEMENTS; i++) {
+        while (!q.QTRY_POP(value)) {
+            this_thread::yield();
+        }
+        sum += value;
+    }
+    producer.join();
+    timer.stop();
+    printThroughput(name, timer, sum);
+}
+
+// То же через QPUSH_BATCH / QPOP_BATCH пакетами по BATCH элементов
+void bench_throughput_batch() {
+    SpscQueue<int> q(RING_CAPACITY);
+    long long sum = 0;
+    cpu_timer timer;
+    thread producer([&q]() {
+        vector<int> batch(BATCH);
+        uint32_t next = 0;
+        while (next < NUM_ELEMENTS) {
+            size_t n = min<size_t>(BATCH, NUM_ELEMENTS - next);
+            for (size_t i = 0; i < n; i++) {
+                batch[i] = static_cast<int>(next + i);
+            }
+            size_t sent = 0;
+            while (sent < n) {
+                size_t pushed = q.QPUSH_BATCH(span<const int>(batch.data() + sent, n - sent));
+                if (pushed == 0) {
+                    this_thread::yield();
+                }
+                sent += pushed;
+            }
+            next += static_cast<uint32_t>(n);
+        }
+    });
+    vector<int> out(BATCH);
+    uint32_t received = 0;
+    while (received < NUM_ELEMENTS) {
+        size_t n = q.QPOP_BATCH(out);
+        if (n == 0) {
+            this_thread::yield();
+        }
+        for (size_t i = 0; i < n; i++) {
+            sum += out[i];
+        }
+        received += static_cast<uint32_t>(n);
+    }
+    producer.join();
+    timer.stop();
+    printThroughput("SpscQueue, пакеты по " + to_string(BATCH), timer, sum);
+}
+
+// Задержка: число уходит по одной очереди и возвращается по другой,
+// выводится среднее время полного обмена
+template <typename QueueType>
+void bench_latency(const string& name, QueueType& forward, QueueType& backward) {
+    cpu_timer timer;
+    thread echo([&forward, &backward]() {
+        int value = 0;
+        for (uint32_t i = 0; i < ROUND_TRIPS; i++) {
+            while (!forward.QTRY_POP(value)) {
+                this_thread::yield();
+            }
+            while (!backward.QTRY_PUSH(value + 1)) {
+                this_thread::yield();
+            }
+        }
+    });
+    int value = 0;
+    for (uint32_t i = 0; i < ROUND_TRIPS; i++) {
+        while (!forward.QTRY_PUSH(value)) {
+            this_thread::yield();
+        }
+        while (!backward.QTRY_POP(value)) {
+            this_thread::yield();
+        }
+    }
+    echo.join();
+    timer.stop();
+    double nanoseconds = static_cast<double>(timer.elapsed().wall) / ROUND_TRIPS;
+    cout << "  " << name << ": " << nanoseconds << " нс на обмен (итог " << value << ")" << endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        NUM_ELEMENTS = static_cast<uint32_t>(stoul(argv[1]));
+    }
+    cout << "Запуск Benchmarks для SpscQueue<T>" << endl;
+    cout << "Аппаратных потоков: " << thread::hardware_concurrency() << endl;
+
+    try {
+        cout << "\nBenchmark: пропускная способность, элементов: " << NUM_ELEMENTS << endl;
+        {
+            LockedQueue q;
+            bench_throughput("Queue + mutex", q);
+        }
+        {
+            SpscQueue<int> q(RING_CAPACITY);
+            bench_throughput("SpscQueue", q);
+        }
+        bench_throughput_batch();
+
+        cout << "\nBenchmark: задержка обмена туда и обратно, обменов: " << ROUND_TRIPS << endl;
+        {
+            LockedQueue forward;
+            LockedQueue backward;
+            bench_latency("Queue + mutex", forward, backward);
+        }
+        {
+            SpscQueue<int> forward(RING_CAPACITY);
+            SpscQueue<int> backward(RING_CAPACITY);
+            bench_latency("SpscQueue", forward, backward);
+        }
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
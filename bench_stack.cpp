@@ -6,6 +6,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include "stack.hpp"
+#include "bench_throughput.hpp"
 
 using namespace std;
 using namespace boost::timer;
@@ -43,6 +44,114 @@ void bench_push_pop() {
     cout << "  Время: " << timerPop.format();
 }
 
+// Короткоживущие стеки: создание, depth вставок и извлечений, уничтожение
+template <typename StackType>
+void run_short_lived(const string& name, uint32_t depth) {
+    const uint32_t rounds = NUM_ELEMENTS;
+    volatile int sink = 0;
+    cpu_timer timer;
+    for (uint32_t r = 0; r < rounds; ++r) {
+        StackType s;
+        for (uint32_t i = 0; i < depth; ++i) {
+            s.SPUSH(static_cast<int>(r + i));
+        }
+        int sum = 0;
+        for (uint32_t i = 0; i < depth; ++i) {
+            sum += s.SPOP();
+        }
+        sink = sink + sum;
+    }
+    timer.stop();
+    cout << "  " << name << ": " << timer.format();
+}
+
+void bench_short_lived() {
+    cout << "\nBenchmark: короткоживущие малые стеки (" << NUM_ELEMENTS << " штук)" << endl;
+    for (uint32_t depth : {1u, 4u, 8u}) {
+        cout << "[Глубина " << depth << "]" << endl;
+        run_short_lived<Stack<int>>("Stack<int>", depth);
+        run_short_lived<SmallStack<int, 8>>("SmallStack<int, 8>", depth);
+    }
+}
+
+// Строки длиннее буфера SSO: каждая копия строки — выделение памяти в куче
+void bench_string_payload() {
+    const uint32_t count = NUM_ELEMENTS / 4;
+    const string payload(40, 's');
+    cout << "\nBenchmark: Stack<string>, строки по " << payload.size() << " символов, " << count << " штук" << endl;
+
+    Stack<string> s;
+    cpu_timer timerPush;
+    for (uint32_t i = 0; i < count; ++i) {
+        string value = payload;
+        s.SPUSH(std::move(value));
+    }
+    timerPush.stop();
+    cout << "  [SPUSH(std::move)] Время: " << timerPush.format();
+
+    size_t totalLength = 0;
+    cpu_timer timerPop;
+    for (uint32_t i = 0; i < count; ++i) {
+        totalLength += s.STOP().size();
+        string value = s.SPOP();
+        totalLength += value.size();
+    }
+    timerPop.stop();
+    cout << "  [STOP + SPOP] Время: " << timerPop.format();
+
+    cpu_timer timerEmplace;
+    for (uint32_t i = 0; i < count; ++i) {
+        s.SEMPLACE(payload.size(), 's');
+    }
+    timerEmplace.stop();
+    cout << "  [SEMPLACE] Время: " << timerEmplace.format();
+    cout << "  Контрольная сумма длин: " << totalLength << endl;
+}
+
+// Пакетная передача: пакет из batch элементов добавляется и сразу
+// извлекается, всего NUM_ELEMENTS элементов. Сравниваются поэлементные SPUSH/SPOP и
+// пакетные SPUSH_BATCH/SPOP_BATCH
+void bench_batch() {
+    cout << "\nBenchmark: пакетные SPUSH/SPOP, элементов: " << NUM_ELEMENTS << endl;
+    for (uint32_t batch : {1u, 16u, 256u, 4096u}) {
+        vector<int> items(batch);
+        vector<int> out(batch);
+        for (uint32_t i = 0; i < batch; ++i) {
+            items[i] = static_cast<int>(i);
+        }
+        const uint32_t rounds = NUM_ELEMENTS / batch;
+        const double total = static_cast<double>(rounds) * batch;
+        long long sum = 0;
+        cout << "[Пакет " << batch << "]" << endl;
+
+        Stack<int> c;
+        cpu_timer timerSingle;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            for (uint32_t i = 0; i < batch; ++i) {
+                c.SPUSH(items[i]);
+            }
+            for (uint32_t i = 0; i < batch; ++i) {
+                out[i] = c.SPOP();
+            }
+            sum += out[batch - 1];
+        }
+        timerSingle.stop();
+        double seconds = static_cast<double>(timerSingle.elapsed().wall) / 1e9;
+        cout << "  SPUSH/SPOP: " << (seconds > 0 ? total / seconds / 1e6 : 0.0) << " млн элементов/с" << endl;
+
+        cpu_timer timerBatch;
+        for (uint32_t r = 0; r < rounds; ++r) {
+            c.SPUSH_BATCH(items);
+            c.SPOP_BATCH(out);
+            sum += out[batch - 1];
+        }
+        timerBatch.stop();
+        seconds = static_cast<double>(timerBatch.elapsed().wall) / 1e9;
+        cout << "  SPUSH_BATCH/SPOP_BATCH: " << (seconds > 0 ? total / seconds / 1e6 : 0.0) << " млн элементов/с"
+             << " (контрольная сумма " << sum << ")" << endl;
+    }
+}
+
 void bench_io() {
     cout << "\nBenchmark: I/O Operations (Text vs Binary)" << endl;
     
@@ -60,6 +169,7 @@ void bench_io() {
     s.SSAVE(txtFile);
     tTS.stop();
     cout << tTS.format();
+    printThroughput(txtFile, tTS);
 
     // TEXT LOAD
     cout << "[Text Load]   ";
@@ -68,6 +178,7 @@ void bench_io() {
     sTxt.SLOAD(txtFile);
     tTL.stop();
     cout << tTL.format();
+    printThroughput(txtFile, tTL);
 
     // BINARY SAVE
     cout << "[Binary Save] ";
@@ -75,6 +186,7 @@ void bench_io() {
     s.SSAVE_BINARY(binFile);
     tBS.stop();
     cout << tBS.format();
+    printThroughput(binFile, tBS);
 
     // BINARY LOAD
     cout << "[Binary Load] ";
@@ -83,6 +195,7 @@ void bench_io() {
     sBin.SLOAD_BINARY(binFile);
     tBL.stop();
     cout << tBL.format();
+    printThroughput(binFile, tBL);
 
     // Удаление временных файлов
     remove(txtFile.c_str());
@@ -95,6 +208,9 @@ int main() {
 
     try {
         bench_push_pop();
+        bench_short_lived();
+        bench_string_payload();
+        bench_batch();
         bench_io();
     } catch (const exception& e) {
         cerr << "CRITICAL ERROR: " << e.what() << endl;
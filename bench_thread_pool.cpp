@@ -0,0 +1,130 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <boost/timer/timer.hpp>
+#include "thread_pool.hpp"
+
+using namespace std;
+using namespace boost::timer;
+
+// Аргумент fib и порог, ниже которого задача считается последовательно
+const int FIB_N = 38;
+const int FIB_CUTOFF = 22;
+// Количество элементов для параллельной суммы
+const size_t SUM_SIZE = 64 * 1024 * 1024;
+const size_t SUM_CHUNK = 64 * 1024;
+
+auto fibSerial(int n) -> int64_t {
+    return n < 2 ? n : fibSerial(n - 1) + fibSerial(n - 2);
+}
+
+auto fibParallel(ThreadPool& pool, int n) -> int64_t {
+    if (n < FIB_CUTOFF) {
+        return fibSerial(n);
+    }
+    int64_t a = 0;
+    int64_t b = 0;
+    pool.parallel_invoke([&]() { a = fibParallel(pool, n - 1); }, [&]() { b = fibParallel(pool, n - 2); });
+    return a + b;
+}
+
+// Сумма рекурсивным fork/join: половины диапазона считаются параллельно
+auto sumForkJoin(ThreadPool& pool, const uint32_t* data, size_t count) -> uint64_t {
+    if (count <= SUM_CHUNK) {
+        return accumulate(data, data + count, uint64_t{0});
+    }
+    uint64_t left = 0;
+    uint64_t right = 0;
+    size_t half = count / 2;
+    pool.parallel_invoke([&]() { left = sumForkJoin(pool, data, half); },
+                         [&]() { right = sumForkJoin(pool, data + half, count - half); });
+    return left + right;
+}
+
+// Сумма через parallel_for: каждый кусок пишет свою частичную сумму
+auto sumParallelFor(ThreadPool& pool, const vector<uint32_t>& data) -> uint64_t {
+    size_t chunks = (data.size() + SUM_CHUNK - 1) / SUM_CHUNK;
+    vector<uint64_t> partial(chunks, 0);
+    pool.parallel_for(0, chunks, [&](size_t c) {
+        size_t first = c * SUM_CHUNK;
+        size_t last = min(first + SUM_CHUNK, data.size());
+        partial[c] = accumulate(data.begin() + static_cast<ptrdiff_t>(first),
+                                data.begin() + static_cast<ptrdiff_t>(last), uint64_t{0});
+    }, 1);
+    return accumulate(partial.begin(), partial.end(), uint64_t{0});
+}
+
+template <typename Run>
+auto timeRun(Run run, uint64_t& result) -> double {
+    cpu_timer timer;
+    result = run();
+    timer.stop();
+    return static_cast<double>(timer.elapsed().wall) / 1e6;
+}
+
+void printRow(unsigned threads, double ms, double serialMs, uint64_t result) {
+    cout << "  потоков: " << threads << ", " << ms << " мс, ускорение " << serialMs / ms
+         << " (результат " << result << ")" << endl;
+}
+
+auto threadCounts() -> vector<unsigned> {
+    vector<unsigned> counts = {1, 2, 4, 8};
+    unsigned hardware = thread::hardware_concurrency();
+    if (hardware > 8) {
+        counts.push_back(hardware);
+    }
+    return counts;
+}
+
+void bench_fib() {
+    cout << "\nBenchmark: fib(" << FIB_N << "), fork/join с порогом " << FIB_CUTOFF << endl;
+    uint64_t result = 0;
+    double serialMs = timeRun([]() { return static_cast<uint64_t>(fibSerial(FIB_N)); }, result);
+    cout << "  Последовательно: " << serialMs << " мс (результат " << result << ")" << endl;
+    for (unsigned threads : threadCounts()) {
+        ThreadPool pool(threads);
+        double ms = timeRun([&pool]() { return static_cast<uint64_t>(fibParallel(pool, FIB_N)); }, result);
+        printRow(threads, ms, serialMs, result);
+    }
+}
+
+void bench_sum() {
+    cout << "\nBenchmark: сумма " << SUM_SIZE << " элементов uint32_t" << endl;
+    vector<uint32_t> data(SUM_SIZE);
+    for (size_t i = 0; i < SUM_SIZE; i++) {
+        data[i] = static_cast<uint32_t>(i * 2654435761u);
+    }
+    uint64_t result = 0;
+    double serialMs = timeRun([&data]() { return accumulate(data.begin(), data.end(), uint64_t{0}); }, result);
+    cout << "  Последовательно: " << serialMs << " мс (результат " << result << ")" << endl;
+
+    cout << "[parallel_for]" << endl;
+    for (unsigned threads : threadCounts()) {
+        ThreadPool pool(threads);
+        double ms = timeRun([&]() { return sumParallelFor(pool, data); }, result);
+        printRow(threads, ms, serialMs, result);
+    }
+    cout << "[fork/join]" << endl;
+    for (unsigned threads : threadCounts()) {
+        ThreadPool pool(threads);
+        double ms = timeRun([&]() { return sumForkJoin(pool, data.data(), data.size()); }, result);
+        printRow(threads, ms, serialMs, result);
+    }
+}
+
+int main() {
+    cout << "Запуск Benchmarks для ThreadPool" << endl;
+    cout << "Аппаратных потоков: " << thread::hardware_concurrency() << endl;
+
+    try {
+        bench_fib();
+        bench_sum();
+    } catch (const exception& e) {
+        cerr << "Exception caught: " << e.what() << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+#ifndef BENCH_THROUGHPUT_HPP
+#define BENCH_THROUGHPUT_HPP
+
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <boost/timer/timer.hpp>
+
+using namespace std;
+
+// Пропускная способность операции ввода-вывода в МБ/с по размеру файла
+inline void printThroughput(const string& filename, const boost::timer::cpu_timer& timer) {
+    double megabytes = static_cast<double>(filesystem::file_size(filename)) / (1024.0 * 1024.0);
+    double seconds = static_cast<double>(timer.elapsed().wall) / 1e9;
+    cout << "  " << megabytes << " МБ, " << (seconds > 0 ? megabytes / seconds : 0.0) << " МБ/с" << endl;
+}
+
+#endif  // BENCH_THROUGHPUT_HPP
@@ -0,0 +1,77 @@
+#ifndef BINARY_FORMAT_HPP
+#define BINARY_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+// Заголовок бинарных файлов MSAVE_BINARY / SSAVE_BINARY / QSAVE_BINARY.
+// Текущий формат (16 байт): uint32 marker = 0xFFFFFFFF, uint32 version,
+// uint64 size, затем size элементов. Старый формат начинался сразу с uint32
+// size; размер 0xFFFFFFFF в нём был недостижим, поэтому маркер однозначно
+// отличает новые файлы от старых, и старые файлы по-прежнему читаются.
+// Сжатые файлы (MSAVE_COMPRESSED) используют тот же заголовок с версией
+// compressedVersion.
+namespace binary_format {
+
+inline constexpr uint32_t marker = 0xFFFFFFFFu;
+inline constexpr uint32_t version = 1;
+inline constexpr uint32_t compressedVersion = 2;
+inline constexpr size_t headerBytes = 2 * sizeof(uint32_t) + sizeof(uint64_t);
+inline constexpr size_t legacyHeaderBytes = sizeof(uint32_t);
+
+inline void writeHeader(std::ostream& out, uint64_t size, uint32_t formatVersion = version) {
+    char header[headerBytes];
+    memcpy(header, &marker, sizeof(marker));
+    memcpy(header + sizeof(uint32_t), &formatVersion, sizeof(formatVersion));
+    memcpy(header + 2 * sizeof(uint32_t), &size, sizeof(size));
+    out.write(header, headerBytes);
+}
+
+// Чтение заголовка из потока; false, если файл короче заголовка
+// или записан другой версией формата
+inline auto readHeader(std::istream& in, uint64_t& size, uint32_t formatVersion = version) -> bool {
+    uint32_t first = 0;
+    if (!in.read(reinterpret_cast<char*>(&first), sizeof(first))) {
+        return false;
+    }
+    if (first != marker) {
+        size = first;  // Старый 32-битный заголовок (только несжатый формат)
+        return formatVersion == version;
+    }
+    uint32_t fileVersion = 0;
+    if (!in.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion)) || fileVersion != formatVersion) {
+        return false;
+    }
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&size), sizeof(size)));
+}
+
+// Разбор заголовка в начале отображённого файла: длина заголовка в байтах
+// или 0, если заголовок неполный или версия не поддерживается
+inline auto parseHeader(const char* data, size_t bytes, uint64_t& size) -> size_t {
+    uint32_t first = 0;
+    if (bytes < legacyHeaderBytes) {
+        return 0;
+    }
+    memcpy(&first, data, sizeof(first));
+    if (first != marker) {
+        size = first;
+        return legacyHeaderBytes;
+    }
+    uint32_t fileVersion = 0;
+    if (bytes < headerBytes) {
+        return 0;
+    }
+    memcpy(&fileVersion, data + sizeof(uint32_t), sizeof(fileVersion));
+    if (fileVersion != version) {
+        return 0;
+    }
+    memcpy(&size, data + 2 * sizeof(uint32_t), sizeof(size));
+    return headerBytes;
+}
+
+}  // namespace binary_format
+
+#endif  // BINARY_FORMAT_HPP
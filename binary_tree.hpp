@@ -8,6 +8,7 @@
 #include <string>
 #include <stdexcept> 
 #include "queue.hpp"
+#include "text_codec.hpp"
 
 using namespace std;
 
@@ -295,14 +296,16 @@ class FullBinaryTree {
 
     // Сохранение дерева в файл
     void TSAVE(const string& filename) const {
-        ofstream file(filename);
+        text_codec::Writer file(filename);
         if (!file.is_open()) {
             throw runtime_error("Couldn't open the file for writing: " + filename);
         }
 
         if (root == nullptr) {
-            file.close();
             // Можно просто выйти, создав пустой файл
+            if (!file.close()) {
+                throw runtime_error("Error when writing data to a file: " + filename);
+            }
             return;
         }
 
@@ -311,10 +314,11 @@ class FullBinaryTree {
 
         while (!q.empty()) {
             TreeNode<T>* current = q.QPOP();
-            file << current->key << " "; 
+            file.write(current->key);
+            file.put(' ');
             
             // Проверка на ошибки записи (например, место кончилось)
-            if (file.fail()) {
+            if (!file.good()) {
                 throw runtime_error("Error when writing data to a file: " + filename);
             }
 
@@ -326,13 +330,15 @@ class FullBinaryTree {
             }
         }
 
-        file.close();
+        if (!file.close()) {
+            throw runtime_error("Error when writing data to a file: " + filename);
+        }
         cout << "Полное бинарное дерево сохранено в файл: " << filename << endl;
     }
 
     // Загрузка дерева из файла
     void TLOAD(const string& filename) {
-        ifstream file(filename);
+        text_codec::Reader file(filename);
         if (!file.is_open()) {
             throw runtime_error("Couldn't open the file for reading: " + filename);
         }
@@ -341,7 +347,7 @@ class FullBinaryTree {
         root = nullptr;
 
         T value;
-        while (file >> value) {
+        while (file.read(value)) {
             TINSERT(value);
         }
 
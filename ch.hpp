@@ -10,6 +10,7 @@
 #include <fstream>
 #include <stdexcept> 
 #include "array.hpp"
+#include "text_codec.hpp"
 
 using namespace std;
 
@@ -34,7 +35,8 @@ class CuckooHash {
     uint32_t tableSize;   // Размер таблицы
     uint32_t elementsCount;    // Количество элементов
     // Дробная часть золотого сечения
-    const double A = (sqrt(5.0) - 1.0) / 2.0;
+    // в формате с фиксированной точкой: A * 2^64
+    static constexpr uint64_t A = 0x9E3779B97F4A7C15ULL;
 
     // Первая хэш-функция
     [[nodiscard]] auto hash1(const string& key) const -> uint32_t {
@@ -42,9 +44,10 @@ class CuckooHash {
         for (char c : key) {
             numKey = numKey * 31 + static_cast<uint64_t>(c);
         }
-        double temp = numKey * A;
-        temp = temp - floor(temp);
-        return static_cast<uint32_t>(floor(tableSize * temp));
+        // Дробная часть k * A — младшие 64 бита произведения; в double
+        // она терялась для длинных ключей. floor(M * frac) — старшие 64 бита
+        uint64_t fraction = numKey * A;
+        return static_cast<uint32_t>((static_cast<unsigned __int128>(fraction) * tableSize) >> 64);
     }
 
     // Вторая хэш-функция
@@ -69,7 +72,8 @@ class CuckooHash {
     // Расширение таблицы
     void resize() {
         uint32_t oldSize = tableSize;
-        Array<HashNode<T>> oldTable = table;
+        // Старая таблица нужна только для чтения: забираем её буфер без копирования
+        Array<HashNode<T>> oldTable = std::move(table);
 
         tableSize = tableSize * 2 + 1;
 
@@ -247,30 +251,40 @@ class CuckooHash {
     // Первая строка: [Размер таблицы] [Количество элементов]
     // Далее строки: [Индекс] [Ключ] [Значение]
     void serialize_text(const string& filename) const {
-        ofstream outFile(filename);
+        text_codec::Writer outFile(filename);
         if (!outFile.is_open()) {
             throw runtime_error("Error: Could not open file for writing: " + filename);
         }
 
         // Записываем заголовок
-        outFile << tableSize << " " << elementsCount << endl;
+        outFile.write(tableSize);
+        outFile.put(' ');
+        outFile.write(elementsCount);
+        outFile.put('\n');
 
         // Записываем только занятые ячейки
         for (uint32_t i = 0; i < tableSize; i++) {
             if (table[i].isOccupied) {
-                // Сохраняем индекс, чтобы при загрузке поместить элемент
-                // ровно в ту же позицию (важно для структуры Cuckoo Hash)
-                outFile << i << " " << table[i].key << " " << table[i].value << endl;
+                // Индекс сохраняется ради совместимости формата; при загрузке
+                // элементы вставляются заново текущими хэш-функциями
+                outFile.write(i);
+                outFile.put(' ');
+                outFile.write(table[i].key);
+                outFile.put(' ');
+                outFile.write(table[i].value);
+                outFile.put('\n');
             }
         }
 
-        outFile.close();
+        if (!outFile.close()) {
+            throw runtime_error("Error: Write operation failed for file: " + filename);
+        }
         cout << "Таблица (текст) успешно сохранена в " << filename << endl;
     }
 
     // Десериализация из текстового формата
     void deserialize_text(const string& filename) {
-        ifstream inFile(filename);
+        text_codec::Reader inFile(filename);
         if (!inFile.is_open()) {
             throw runtime_error("Error: Could not open file for reading: " + filename);
         }
@@ -279,7 +293,7 @@ class CuckooHash {
         uint32_t newElementsCount = 0;
 
         // Читаем заголовок
-        if (!(inFile >> newTableSize >> newElementsCount)) {
+        if (!inFile.read(newTableSize) || !inFile.read(newElementsCount)) {
             throw runtime_error("Error: Incorrect file format or empty file: " + filename);
         }
         
@@ -290,7 +304,7 @@ class CuckooHash {
         table.SetSize(newTableSize);
 
         tableSize = newTableSize;
-        elementsCount = newElementsCount;
+        elementsCount = 0;  // Пересчитывается при вставке; newElementsCount только читается
 
         // Читаем данные
         uint32_t idx;
@@ -298,14 +312,15 @@ class CuckooHash {
         T value;
 
         // Цикл чтения пока есть данные
-        while (inFile >> idx >> key >> value) {
-            if (idx < tableSize) {
-                // Вставляем напрямую в ячейку, чтобы сохранить структуру хэш-таблицы
-                // как она была при сохранении (без повторного хэширования)
-                table[idx] = HashNode<T>(key, value);
+        while (inFile.read(idx) && inFile.read(key) && inFile.read(value)) {
+            if (idx < newTableSize) {
+                // Элемент вставляется заново, а не в сохранённую ячейку: файлы,
+                // записанные с прежними хэш-функциями, иначе загружались бы,
+                // но find не находил бы в них ключи
+                insert(key, value);
             } else {
                  throw out_of_range("Error: File index (" + to_string(idx) 
-                     + ") is out of table bounds (" + to_string(tableSize) + ")");
+                     + ") is out of table bounds (" + to_string(newTableSize) + ")");
             }
         }
 
@@ -374,10 +389,11 @@ class CuckooHash {
         table.SetSize(newTableSize);
         
         tableSize = newTableSize;
-        elementsCount = newElementsCount;
+        elementsCount = 0;  // Пересчитывается при вставке
 
-        // Читаем данные ячеек
-        for (uint32_t i = 0; i < tableSize; i++) {
+        // Читаем данные ячеек (вставка может расширить таблицу,
+        // поэтому граница — размер из файла)
+        for (uint32_t i = 0; i < newTableSize; i++) {
             bool occupied = false;
             inFile.read(reinterpret_cast<char*>(&occupied), sizeof(bool));
 
@@ -397,11 +413,9 @@ class CuckooHash {
                 T loadedValue;
                 inFile.read(reinterpret_cast<char*>(&loadedValue), sizeof(T));
 
-                // Записываем в узел напрямую (без insert, чтобы сохранить структуру Cuckoo)
-                table[i] = HashNode<T>(loadedKey, loadedValue);
-            } else {
-                // Если ячейка пуста, она уже инициализирована конструктором HashNode() выше
-                table[i].isOccupied = false;
+                // Вставка заново: ячейка i определялась хэш-функциями,
+                // с которыми файл был записан, и может не совпадать с текущей
+                insert(loadedKey, loadedValue);
             }
 
             // Дополнительная проверка целостности потока после чтения элемента
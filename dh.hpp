@@ -4,10 +4,12 @@
 #include <iostream>
 #include <cstdint>
 #include <cmath>
+#include <numeric>
 #include <string>
 #include <fstream> 
 #include <stdexcept> 
 #include "array.hpp"
+#include "text_codec.hpp"
 
 using namespace std;
 
@@ -32,7 +34,8 @@ class DoubleHash {
     uint32_t tableSize;        // Размер таблицы
     uint32_t elementsCount;    // Количество элементов
     // Дробная часть золотого сечения
-    const double A = (sqrt(5.0) - 1.0) / 2.0;
+    // в формате с фиксированной точкой: A * 2^64
+    static constexpr uint64_t A = 0x9E3779B97F4A7C15ULL;
 
     // Первая хэш-функция: метод умножения
     [[nodiscard]] auto hash1(const string& key) const -> uint32_t {
@@ -43,9 +46,10 @@ class DoubleHash {
         }
 
         // hash(k) = floor(M * ((k * A) mod 1))
-        double temp = numKey * A;
-        temp = temp - floor(temp);   // Получаем дробную часть
-        return static_cast<uint32_t>(floor(tableSize * temp));
+        // Дробная часть k * A — младшие 64 бита произведения; в double
+        // она терялась для длинных ключей. floor(M * frac) — старшие 64 бита
+        uint64_t fraction = numKey * A;
+        return static_cast<uint32_t>((static_cast<unsigned __int128>(fraction) * tableSize) >> 64);
     }
 
     // Вторая хэш-функция: метод свёртки
@@ -59,8 +63,9 @@ class DoubleHash {
         // Возвращаем нечётное число
         uint32_t result = (sum % (tableSize - 1)) + 1;
 
-        // Делаем результат нечётным, если размер таблицы чётный
-        if (tableSize % 2 == 0 && result % 2 == 0) {
+        // Шаг должен быть взаимно прост с размером таблицы, иначе
+        // последовательность проб обходит только часть ячеек
+        while (gcd(result, tableSize) != 1) {
             result++;
         }
 
@@ -76,7 +81,8 @@ class DoubleHash {
     // Расширение таблицы при достижении порога загрузки
     void resize() {
         uint32_t oldSize = tableSize;
-        Array<HashNode<T>> oldTable = table;
+        // Старая таблица нужна только для чтения: забираем её буфер без копирования
+        Array<HashNode<T>> oldTable = std::move(table);
 
         // Увеличиваем размер таблицы
         // Делаем нечётным для лучшего распределения
@@ -254,28 +260,38 @@ class DoubleHash {
     
     // Сериализация в текстовом формате
     void serialize_text(const string& filename) const {
-        ofstream outFile(filename);
+        text_codec::Writer outFile(filename);
         if (!outFile.is_open()) {
             throw runtime_error("Error: Could not open file for writing: " + filename);
         }
 
         // Записываем заголовок
-        outFile << tableSize << " " << elementsCount << endl;
+        outFile.write(tableSize);
+        outFile.put(' ');
+        outFile.write(elementsCount);
+        outFile.put('\n');
 
         // Записываем только занятые ячейки
         for (uint32_t i = 0; i < tableSize; i++) {
             if (table[i].isOccupied) {
-                outFile << i << " " << table[i].key << " " << table[i].value << endl;
+                outFile.write(i);
+                outFile.put(' ');
+                outFile.write(table[i].key);
+                outFile.put(' ');
+                outFile.write(table[i].value);
+                outFile.put('\n');
             }
         }
 
-        outFile.close();
+        if (!outFile.close()) {
+            throw runtime_error("Error: Write operation failed for file: " + filename);
+        }
         cout << "Таблица (текст) успешно сохранена в " << filename << endl;
     }
 
     // Десериализация из текстового формата
     void deserialize_text(const string& filename) {
-        ifstream inFile(filename);
+        text_codec::Reader inFile(filename);
         if (!inFile.is_open()) {
             throw runtime_error("Error: Could not open file for reading: " + filename);
         }
@@ -284,7 +300,8 @@ class DoubleHash {
         uint32_t newElementsCount = 0;
 
         // Читаем заголовок
-        inFile >> newTableSize >> newElementsCount;
+        inFile.read(newTableSize);
+        inFile.read(newElementsCount);
         if (newTableSize == 0)
             throw runtime_error("Could not read data from file. Size of table equal to zero");
 
@@ -300,7 +317,7 @@ class DoubleHash {
         }
 
         tableSize = newTableSize;
-        elementsCount = newElementsCount;
+        elementsCount = 0;  // Пересчитывается при вставке; newElementsCount только читается
 
         // Читаем данные
         uint32_t idx;
@@ -308,17 +325,20 @@ class DoubleHash {
         T value;
 
         // Читаем данные
-        while (inFile >> idx >> key >> value) {
+        while (inFile.read(idx) && inFile.read(key) && inFile.read(value)) {
             
             if (inFile.fail()) {
                  throw runtime_error("Error: Corrupted data in file: " + filename);
             }
 
-            if (idx >= tableSize) {
+            if (idx >= newTableSize) {
                 throw out_of_range("Error: Index in file (" + to_string(idx) + 
-                                        ") exceeds table size (" + to_string(tableSize) + ")");
+                                        ") exceeds table size (" + to_string(newTableSize) + ")");
             }
-            table[idx] = HashNode<T>(key, value);
+            // Элемент вставляется заново, а не в сохранённую ячейку: файлы,
+            // записанные с прежними хэш-функциями, иначе загружались бы,
+            // но find не находил бы в них ключи
+            insert(key, value);
         }
 
         inFile.close();
@@ -378,10 +398,11 @@ class DoubleHash {
         table.SetSize(newTableSize);
 
         tableSize = newTableSize;
-        elementsCount = newElementsCount;
+        elementsCount = 0;  // Пересчитывается при вставке
 
-        // Читаем данные ячеек
-        for (uint32_t i = 0; i < tableSize; i++) {
+        // Читаем данные ячеек (вставка может расширить таблицу,
+        // поэтому граница — размер из файла)
+        for (uint32_t i = 0; i < newTableSize; i++) {
             bool occupied = false;
             inFile.read(reinterpret_cast<char*>(&occupied), sizeof(bool));
 
@@ -419,9 +440,9 @@ class DoubleHash {
                     throw runtime_error("Error: Failed to read value");
                 }
 
-                table[i] = HashNode<T>(loadedKey, loadedValue);
-            } else {
-                table[i].isOccupied = false;
+                // Вставка заново: ячейка i определялась хэш-функциями,
+                // с которыми файл был записан, и может не совпадать с текущей
+                insert(loadedKey, loadedValue);
             }
         }
 
@@ -7,6 +7,7 @@
 #include <fstream>
 #include <sstream>
 #include <stdexcept> 
+#include "text_codec.hpp"
 
 using namespace std;
 
@@ -295,22 +296,25 @@ class DoublyList {
 
     // Сохранение списка в файл
     void LSAVE(const string& filename) const {
-        ofstream file(filename);
+        text_codec::Writer file(filename);
         if (!file.is_open()) {
             throw runtime_error("Error opening file for writing: " + filename);
         }
         DNode<T>* current = head;
         while (current != nullptr) {
-            file << current->key << " ";
+            file.write(current->key);
+            file.put(' ');
             current = current->next;
         }
-        file.close();
+        if (!file.close()) {
+            throw runtime_error("Error writing file: " + filename);
+        }
         cout << "Двусвязный список сохранён в файл: " << filename << endl;
     }
 
     // Загрузка списка из файла
     void LLOAD(const string& filename) {
-        ifstream file(filename);
+        text_codec::Reader file(filename);
         if (!file.is_open()) {
              throw runtime_error("Error opening file for reading: " + filename);
         }
@@ -326,7 +330,7 @@ class DoublyList {
 
         T value;
         bool first = true;
-        while (file >> value) {
+        while (file.read(value)) {
             if (first) {
                 DNode<T>* newDNode = new DNode<T>{ value, nullptr, nullptr };
                 head = newDNode;
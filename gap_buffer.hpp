@@ -0,0 +1,229 @@
+#ifndef GAP_BUFFER_HPP
+#define GAP_BUFFER_HPP
+
+#include <iostream>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <stdexcept>
+#include "allocators.hpp"
+
+using namespace std;
+
+// Буфер с разрывом для локального редактирования: свободное место ("разрыв")
+// держится в точке последней правки. Вставка и удаление рядом с ней стоят O(1),
+// перенос разрыва — O(расстояния), доступ по индексу — O(1).
+// Элементы хранятся в [0, gapStart) и [gapEnd, capacity)
+template <typename T, typename Alloc = allocator<T>>
+class GapBuffer {
+ private:
+    using AllocTraits = allocator_traits<Alloc>;
+
+    [[no_unique_address]] Alloc alloc;
+    T* buffer;
+    size_t capacity;
+    size_t gapStart;
+    size_t gapEnd;
+
+    [[nodiscard]] auto gapLength() const -> size_t {
+        return gapEnd - gapStart;
+    }
+
+    // Физическая позиция логического индекса
+    [[nodiscard]] auto physical(size_t index) const -> size_t {
+        return index < gapStart ? index : index + gapLength();
+    }
+
+    // Перенос count элементов в неинициализированную память (to < from или не пересекаются)
+    static void moveForward(T* from, T* to, size_t count) {
+        if constexpr (is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                memmove(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                new (to + i) T(std::move_if_noexcept(from[i]));
+                from[i].~T();
+            }
+        }
+    }
+
+    // Перенос count элементов в неинициализированную память (to > from)
+    static void moveBackward(T* from, T* to, size_t count) {
+        if constexpr (is_trivially_copyable_v<T>) {
+            if (count > 0) {
+                memmove(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+            }
+        } else {
+            for (size_t i = count; i > 0; i--) {
+                new (to + i - 1) T(std::move_if_noexcept(from[i - 1]));
+                from[i - 1].~T();
+            }
+        }
+    }
+
+    // Перемещение разрыва так, чтобы он начинался с логического индекса pos
+    void moveGap(size_t pos) {
+        if (gapLength() == 0) {
+            // Пустой разрыв переносить нечего: элементы остаются на местах
+            gapStart = pos;
+            gapEnd = pos;
+        } else if (pos < gapStart) {
+            size_t count = gapStart - pos;
+            moveBackward(buffer + pos, buffer + gapEnd - count, count);
+            gapStart = pos;
+            gapEnd -= count;
+        } else if (pos > gapStart) {
+            size_t count = pos - gapStart;
+            moveForward(buffer + gapEnd, buffer + gapStart, count);
+            gapStart = pos;
+            gapEnd += count;
+        }
+    }
+
+    // Удвоение вместимости; разрыв остаётся на месте и расширяется.
+    // growCapacity бросает length_error вместо переполнения при удвоении
+    void grow() {
+        size_t newCapacity = growCapacity(capacity, GetSize() + 1, AllocTraits::max_size(alloc));
+        T* newData = AllocTraits::allocate(alloc, newCapacity);
+        size_t tail = capacity - gapEnd;
+        moveForward(buffer, newData, gapStart);
+        moveForward(buffer + gapEnd, newData + newCapacity - tail, tail);
+        if (buffer != nullptr) {
+            AllocTraits::deallocate(alloc, buffer, capacity);
+        }
+        buffer = newData;
+        gapEnd = newCapacity - tail;
+        capacity = newCapacity;
+    }
+
+    void destroyElements() {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < gapStart; i++) {
+                buffer[i].~T();
+            }
+            for (size_t i = gapEnd; i < capacity; i++) {
+                buffer[i].~T();
+            }
+        }
+    }
+
+ public:
+    GapBuffer() : GapBuffer(Alloc()) {}
+
+    explicit GapBuffer(const Alloc& allocator) : alloc(allocator)
+                                               , buffer(nullptr)
+                                               , capacity(0)
+                                               , gapStart(0)
+                                               , gapEnd(0) {}
+
+    ~GapBuffer() {
+        destroyElements();
+        if (buffer != nullptr) {
+            AllocTraits::deallocate(alloc, buffer, capacity);
+        }
+    }
+
+    // Копирующий конструктор: копия получает разрыв в конце
+    GapBuffer(const GapBuffer& other)
+        : alloc(AllocTraits::select_on_container_copy_construction(other.alloc))
+        , buffer(nullptr)
+        , capacity(0)
+        , gapStart(0)
+        , gapEnd(0) {
+        for (size_t i = 0; i < other.GetSize(); i++) {
+            GPUSH_BACK(other.GGET_UNCHECKED(i));
+        }
+    }
+
+    // Оператор присваивания (копирование и обмен)
+    auto operator=(GapBuffer other) -> GapBuffer& {
+        std::swap(alloc, other.alloc);
+        std::swap(buffer, other.buffer);
+        std::swap(capacity, other.capacity);
+        std::swap(gapStart, other.gapStart);
+        std::swap(gapEnd, other.gapEnd);
+        return *this;
+    }
+
+    // Вставка элемента перед логическим индексом index (разрыв переносится к index)
+    void GPUSH_BY_IND(size_t index, T value) {
+        if (index > GetSize()) {
+            throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for insertion.");
+        }
+        if (gapLength() == 0) {
+            grow();
+        }
+        moveGap(index);
+        new (buffer + gapStart) T(std::move(value));
+        gapStart++;
+    }
+
+    void GPUSH_BACK(T value) {
+        GPUSH_BY_IND(GetSize(), std::move(value));
+    }
+
+    // Удаление элемента по логическому индексу
+    void GDEL_BY_IND(size_t index) {
+        if (index >= GetSize()) {
+            throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for deletion.");
+        }
+        moveGap(index);
+        buffer[gapEnd].~T();
+        gapEnd++;
+    }
+
+    // Доступ по индексу без проверки границ
+    auto GGET_UNCHECKED(size_t index) -> T& {
+        return buffer[physical(index)];
+    }
+
+    auto GGET_UNCHECKED(size_t index) const -> const T& {
+        return buffer[physical(index)];
+    }
+
+    auto operator[](size_t index) -> T& {
+        if (index >= GetSize()) {
+            throw out_of_range("Error: Index " + to_string(index)
+            + " is out of bounds (size " + to_string(GetSize()) + ").");
+        }
+        return GGET_UNCHECKED(index);
+    }
+
+    auto operator[](size_t index) const -> const T& {
+        if (index >= GetSize()) {
+            throw out_of_range("Error: Index " + to_string(index)
+            + " is out of bounds (size " + to_string(GetSize()) + ").");
+        }
+        return GGET_UNCHECKED(index);
+    }
+
+    void PRINT() const {
+        for (size_t i = 0; i < gapStart; i++) {
+            cout << buffer[i] << " ";
+        }
+        for (size_t i = gapEnd; i < capacity; i++) {
+            cout << buffer[i] << " ";
+        }
+        cout << endl;
+    }
+
+    [[nodiscard]] auto GetSize() const -> size_t {
+        return capacity - gapLength();
+    }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return capacity;
+    }
+
+    // Логический индекс начала разрыва (позиция "курсора")
+    [[nodiscard]] auto GetGapPosition() const -> size_t {
+        return gapStart;
+    }
+};
+
+#endif  // GAP_BUFFER_HPP
@@ -0,0 +1,250 @@
+#ifndef PRIORITY_QUEUE_HPP
+#define PRIORITY_QUEUE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "array.hpp"
+
+using namespace std;
+
+// Очередь с приоритетом на d-арной куче поверх Array. Вершина — наибольший
+// элемент по Compare (как у std::priority_queue); с greater<T> — наименьший.
+// PPUSH / PPOP стоят O(log_d n), построение из массива — O(n).
+// Arity 4 или 8 делает кучу ниже, а потомки одного узла лежат подряд
+// в одной-двух кэш-линиях, поэтому просеивание вниз реже промахивается мимо кэша.
+// PPUSH возвращает дескриптор (Handle), по которому элемент можно найти,
+// изменить (PUPDATE — в том числе decrease-key) или удалить (PERASE).
+// Дескриптор действителен, пока его элемент в очереди; после извлечения
+// он может быть выдан повторно
+template <typename T, typename Compare = less<T>, uint32_t Arity = 4, typename Alloc = allocator<T>>
+class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
+ public:
+    using Handle = size_t;
+
+ private:
+    struct Entry {
+        T value;
+        Handle handle;
+    };
+
+    using EntryAlloc = typename allocator_traits<Alloc>::template rebind_alloc<Entry>;
+    using IndexAlloc = typename allocator_traits<Alloc>::template rebind_alloc<size_t>;
+
+    // Позиция дескриптора, элемент которого уже извлечён
+    static constexpr size_t removed = SIZE_MAX;
+
+    [[no_unique_address]] Compare comp;
+    Array<Entry, EntryAlloc> heap;
+    Array<size_t, IndexAlloc> positions;    // Дескриптор -> индекс в heap
+    Array<Handle, IndexAlloc> freeHandles;  // Дескрипторы извлечённых элементов
+
+    static constexpr auto parent(size_t index) -> size_t {
+        return (index - 1) / Arity;
+    }
+
+    static constexpr auto firstChild(size_t index) -> size_t {
+        return index * Arity + 1;
+    }
+
+    auto at(size_t index) -> Entry& {
+        return heap.MGET_UNCHECKED(index);
+    }
+
+    // Запись элемента в ячейку index с обновлением позиции его дескриптора
+    void place(size_t index, Entry&& entry) {
+        positions.MGET_UNCHECKED(entry.handle) = index;
+        at(index) = std::move(entry);
+    }
+
+    // Просеивание вверх с "дыркой": родители сдвигаются вниз, а entry
+    // записывается один раз в итоговую ячейку — вместо swap на каждом уровне
+    void siftUp(size_t index, Entry entry) {
+        while (index > 0) {
+            size_t up = parent(index);
+            if (!comp(at(up).value, entry.value)) {
+                break;
+            }
+            place(index, std::move(at(up)));
+            index = up;
+        }
+        place(index, std::move(entry));
+    }
+
+    // Просеивание вниз с "дыркой": на каждом уровне выбирается лучший
+    // из Arity потомков, лежащих подряд
+    void siftDown(size_t index, Entry entry) {
+        size_t count = heap.GetSize();
+        while (true) {
+            size_t first = firstChild(index);
+            if (first >= count) {
+                break;
+            }
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; child++) {
+                if (comp(at(best).value, at(child).value)) {
+                    best = child;
+                }
+            }
+            if (!comp(entry.value, at(best).value)) {
+                break;
+            }
+            place(index, std::move(at(best)));
+            index = best;
+        }
+        place(index, std::move(entry));
+    }
+
+    // Удаление ячейки index: на её место встаёт последний элемент
+    void removeAt(size_t index) {
+        Handle handle = at(index).handle;
+        size_t last = heap.GetSize() - 1;
+        if (index != last) {
+            Entry moved = std::move(at(last));
+            heap.MDEL_BY_IND(last);
+            if (index > 0 && comp(at(parent(index)).value, moved.value)) {
+                siftUp(index, std::move(moved));
+            } else {
+                siftDown(index, std::move(moved));
+            }
+        } else {
+            heap.MDEL_BY_IND(last);
+        }
+        positions.MGET_UNCHECKED(handle) = removed;
+        freeHandles.MPUSH_BACK(handle);
+    }
+
+    auto positionOf(Handle handle) const -> size_t {
+        if (handle >= positions.GetSize() || positions.MGET_UNCHECKED(handle) == removed) {
+            throw out_of_range("PriorityQueue: handle " + to_string(handle) + " is not in the queue");
+        }
+        return positions.MGET_UNCHECKED(handle);
+    }
+
+    void requireNotEmpty() const {
+        if (heap.GetSize() == 0) {
+            throw out_of_range("PriorityQueue is empty: no top element");
+        }
+    }
+
+ public:
+    explicit PriorityQueue(const Compare& compare = Compare(), const Alloc& allocator = Alloc())
+        : comp(compare)
+        , heap(EntryAlloc(allocator))
+        , positions(IndexAlloc(allocator))
+        , freeHandles(IndexAlloc(allocator)) {}
+
+    // Построение кучи из values за O(n) (алгоритм Флойда): элементы копируются
+    // как есть, затем просеиваются вниз от последнего внутреннего узла к корню.
+    // Дескриптор values[i] равен i
+    template <typename U, size_t Extent>
+    explicit PriorityQueue(std::span<U, Extent> values, const Compare& compare = Compare(),
+                           const Alloc& allocator = Alloc())
+        : PriorityQueue(compare, allocator) {
+        static_assert(is_same_v<remove_const_t<U>, T>, "PriorityQueue: span element type must be T");
+        size_t count = values.size();
+        heap.SetCapacity(count > 0 ? count : 1);
+        positions.SetCapacity(count > 0 ? count : 1);
+        for (size_t i = 0; i < count; i++) {
+            heap.MPUSH_BACK(Entry{values[i], i});
+            positions.MPUSH_BACK(i);
+        }
+        for (size_t i = count > 1 ? parent(count - 1) + 1 : 0; i-- > 0;) {
+            siftDown(i, std::move(at(i)));
+        }
+    }
+
+    template <typename A, uint32_t N>
+    explicit PriorityQueue(const Array<T, A, N>& values, const Compare& compare = Compare(),
+                           const Alloc& allocator = Alloc())
+        : PriorityQueue(values.span(), compare, allocator) {}
+
+    // Добавление элемента; возвращает его дескриптор
+    auto PPUSH(T value) -> Handle {
+        Handle handle;
+        if (freeHandles.GetSize() > 0) {
+            handle = freeHandles.MGET_UNCHECKED(freeHandles.GetSize() - 1);
+            freeHandles.MDEL_BY_IND(freeHandles.GetSize() - 1);
+        } else {
+            handle = positions.GetSize();
+            positions.MPUSH_BACK(removed);
+        }
+        size_t index = heap.GetSize();
+        heap.MPUSH_BACK(Entry{std::move(value), handle});
+        siftUp(index, std::move(at(index)));
+        return handle;
+    }
+
+    // Извлечение вершины с перемещением значения
+    auto PPOP() -> T {
+        requireNotEmpty();
+        T top = std::move(at(0).value);
+        removeAt(0);
+        return top;
+    }
+
+    auto PTOP() const -> const T& {
+        requireNotEmpty();
+        return heap.MGET_UNCHECKED(0).value;
+    }
+
+    // Дескриптор элемента на вершине
+    auto PTOP_HANDLE() const -> Handle {
+        requireNotEmpty();
+        return heap.MGET_UNCHECKED(0).handle;
+    }
+
+    // Замена значения элемента: просеивание вверх, если новое значение
+    // приоритетнее старого (decrease-key для Compare = greater<T>), иначе вниз
+    void PUPDATE(Handle handle, T value) {
+        size_t index = positionOf(handle);
+        bool raise = comp(at(index).value, value);
+        Entry entry{std::move(value), handle};
+        if (raise) {
+            siftUp(index, std::move(entry));
+        } else {
+            siftDown(index, std::move(entry));
+        }
+    }
+
+    // Удаление произвольного элемента по дескриптору
+    void PERASE(Handle handle) {
+        removeAt(positionOf(handle));
+    }
+
+    [[nodiscard]] auto PCONTAINS(Handle handle) const -> bool {
+        return handle < positions.GetSize() && positions.MGET_UNCHECKED(handle) != removed;
+    }
+
+    auto PGET(Handle handle) const -> const T& {
+        return heap.MGET_UNCHECKED(positionOf(handle)).value;
+    }
+
+    [[nodiscard]] auto GetSize() const -> size_t {
+        return heap.GetSize();
+    }
+
+    [[nodiscard]] auto empty() const -> bool {
+        return heap.GetSize() == 0;
+    }
+
+    // Резервирование места под newCapacity элементов без перераспределений
+    void SetCapacity(size_t newCapacity) {
+        if (newCapacity > heap.GetCapacity()) {
+            heap.SetCapacity(newCapacity);
+        }
+        if (newCapacity > positions.GetCapacity()) {
+            positions.SetCapacity(newCapacity);
+        }
+    }
+};
+
+#endif  // PRIORITY_QUEUE_HPP
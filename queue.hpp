@@ -7,116 +7,314 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <memory>
+#include <span>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <chrono>
+#include <climits>
+#include "allocators.hpp"
+#include "binary_format.hpp"
+#include "text_codec.hpp"
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/futex.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
-template <typename T>
+// Alloc — политика выделения памяти (см. allocators.hpp).
+// Вместимость всегда степень двойки: индексы кольца берутся по маске
+template <typename T, typename Alloc = allocator<T>>
 class Queue {
  private:
-    uint32_t capacity;  // Общая вместимость массива
-    uint32_t size;      // Текущее количество элементов
-    T* data;            // Указатель на динамический массив
+    using AllocTraits = allocator_traits<Alloc>;
+
+    [[no_unique_address]] Alloc alloc;
+    size_t capacity;  // Общая вместимость массива
+    size_t size;      // Текущее количество элементов
+    T* data;            // Кольцевой буфер; сконструированы только элементы очереди
+
+    size_t head;  // Индекс "головы"
+    size_t tail;  // Индекс "хвоста"
+    ShrinkPolicy shrinkPolicy;  // По умолчанию очередь не уменьшается
 
-    uint32_t head;  // Индекс "головы"
-    uint32_t tail;  // Индекс "хвоста"
+    static constexpr size_t streamBlockBytes = 1 << 20;  // Блок чтения QPUSH_FD
 
-    // Вспомогательная функция для расширения массива
-    void resize() {
-        uint32_t newCapacity = capacity * 2;
-        T* newData = new T[newCapacity];
+    // Индекс в кольцевом буфере: маска вместо деления по модулю
+    [[nodiscard]] auto wrap(size_t index) const -> size_t {
+        return index & (capacity - 1);
+    }
+
+    // Наибольшая вместимость-степень двойки, которую допускает аллокатор
+    [[nodiscard]] static auto maxRingCapacity(const Alloc& allocator) -> size_t {
+        return bit_floor(AllocTraits::max_size(allocator));
+    }
 
-        // Копируем элементы из старого массива в новый, "распрямляя" кольцевой буфер
-        for (uint32_t i = 0; i < size; ++i) {
-            newData[i] = data[(head + i) % capacity];
+    // Наименьшая степень двойки, вмещающая required элементов
+    static auto ringCapacity(size_t required, const Alloc& allocator) -> size_t {
+        if (required > maxRingCapacity(allocator)) {
+            throw length_error("Error: Container size exceeds the allocator's max_size().");
         }
+        return bit_ceil(max<size_t>(required, 1));
+    }
 
-        delete[] data;  // Освобождаем старую память
+    // Вызов деструкторов для всех элементов очереди
+    void destroyElements() {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size; ++i) {
+                data[wrap(head + i)].~T();
+            }
+        }
+    }
+
+    // Копирование элементов other в пустой буфер подходящей вместимости
+    void copyElementsFrom(const Queue& other) {
+        for (size_t i = 0; i < other.size; ++i) {
+            new (data + i) T(other.data[other.wrap(other.head + i)]);
+            size++;
+        }
+        tail = wrap(size);
+    }
+
+    // Перенос элементов в неинициализированный буфер newData,
+    // "распрямляя" кольцевой буфер: голова попадает в нулевую ячейку
+    void relocateTo(T* newData) {
+        for (size_t i = 0; i < size; ++i) {
+            T& item = data[wrap(head + i)];
+            new (newData + i) T(std::move_if_noexcept(item));
+            item.~T();
+        }
+    }
+
+    // Перенос элементов в буфер вместимостью newCapacity (не меньше size)
+    void reallocate(size_t newCapacity) {
+        T* newData = AllocTraits::allocate(alloc, newCapacity);
+        relocateTo(newData);
+        AllocTraits::deallocate(alloc, data, capacity);  // Освобождаем старую память
 
         data = newData;
         capacity = newCapacity;
         head = 0;       // Голова теперь в начале нового массива
-        tail = size;    // Хвост следует за последним элементом
+        tail = wrap(size);  // Хвост следует за последним элементом
     }
 
- public:
-    Queue() : capacity(1)
-            , size(0)
-            , head(0)
-            , tail(0)
-            , data(new T[1]) {
-        for (uint32_t i = 0; i < capacity; i++) {
-            data[i] = T();
+    // Пустая очередь с вместимостью не меньше required; старые элементы
+    // удаляются без переноса
+    void resetStorage(size_t required) {
+        destroyElements();
+        size = 0;
+        head = 0;
+        tail = 0;
+        size_t newCapacity = ringCapacity(required, alloc);
+        if (newCapacity > capacity) {
+            T* newData = AllocTraits::allocate(alloc, newCapacity);
+            AllocTraits::deallocate(alloc, data, capacity);
+            data = newData;
+            capacity = newCapacity;
         }
     }
 
-    // Конструктор: инициализирует очередь с заданной вместимостью
-    explicit Queue(const uint32_t cap) : size(0)
-                                , capacity(cap > 0 ? cap : 1)
-                                , head(0)
-                                , tail(0)
-                                , data(new T[cap > 0 ? cap : 1]) {
-        for (uint32_t i = 0; i < capacity; i++) {
-            data[i] = T();
+    void shrinkIfNeeded() {
+        size_t newCapacity = shrinkPolicy.shrinkTo(size, capacity);
+        if (newCapacity < capacity) {
+            reallocate(newCapacity);
         }
     }
 
+ public:
+    Queue() : Queue(Alloc()) {}
+
+    // Конструктор пустой очереди с заданным аллокатором
+    explicit Queue(const Alloc& allocator) : alloc(allocator)
+                                           , capacity(1)
+                                           , size(0)
+                                           , head(0)
+                                           , tail(0)
+                                           , data(AllocTraits::allocate(alloc, 1)) {}
+
+    // Конструктор: инициализирует очередь с вместимостью не меньше cap
+    // (округляется вверх до степени двойки)
+    explicit Queue(const size_t cap, const Alloc& allocator = Alloc()) : alloc(allocator)
+                                , size(0)
+                                , capacity(ringCapacity(cap, allocator))
+                                , head(0)
+                                , tail(0)
+                                , data(AllocTraits::allocate(alloc, capacity)) {}
+
     // Деструктор: освобождает выделенную память
     ~Queue() {
-        delete[] data;
+        destroyElements();
+        AllocTraits::deallocate(alloc, data, capacity);
     }
 
-    // Копирующий конструктор
-    Queue(const Queue<T>& other) : capacity(other.capacity)
-                                    , size(other.size)
-                                    , head(other.head)
-                                    , tail(other.tail)
-                                    , data(new T[other.capacity]) {
-        for (uint32_t i = 0; i < capacity; i++) {
-            data[i] = other.data[i];
-        }
+    // Копирующий конструктор: элементы копируются подряд, начиная с нулевой ячейки
+    Queue(const Queue& other) : alloc(AllocTraits::select_on_container_copy_construction(other.alloc))
+                              , capacity(other.capacity)
+                              , size(0)
+                              , head(0)
+                              , tail(0)
+                              , data(AllocTraits::allocate(alloc, other.capacity)) {
+        copyElementsFrom(other);
+        shrinkPolicy = other.shrinkPolicy;
     }
 
     // Копирующий оператор присваивания
-    auto operator=(const Queue<T>& other) -> Queue<T>& {
+    auto operator=(const Queue& other) -> Queue& {
         if (this == &other) {
             return *this;
         }
 
-        delete[] data;  // Освобождаем старую память
-        capacity = other.capacity;
-        size = other.size;
-        head = other.head;
-        tail = other.tail;
-        data = new T[capacity];
-        for (uint32_t i = 0; i < capacity; i++) {
-            data[i] = other.data[i];
+        destroyElements();
+        AllocTraits::deallocate(alloc, data, capacity);  // Освобождаем старую память
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            alloc = other.alloc;
         }
+        capacity = other.capacity;
+        size = 0;
+        head = 0;
+        tail = 0;
+        data = AllocTraits::allocate(alloc, capacity);
+        copyElementsFrom(other);
+        shrinkPolicy = other.shrinkPolicy;
         return *this;
     }
 
-    // Добавление элемента в конец очереди
-    void QPUSH(T value) {
-        if (size >= capacity) {
-            resize();  // Если места нет, расширяем массив
+    // Конструирование элемента в конце очереди прямо из аргументов
+    template <typename... Args>
+    auto QEMPLACE(Args&&... args) -> T& {
+        if (size < capacity) {
+            T* slot = new (data + tail) T(std::forward<Args>(args)...);
+            tail = wrap(tail + 1);  // Сдвигаем хвост по кругу
+            size++;
+            return *slot;
         }
-        data[tail] = value;
-        tail = (tail + 1) % capacity;  // Сдвигаем хвост по кругу
+        // Если места нет, расширяем массив. Новый элемент конструируется до
+        // переноса старых: args может ссылаться на элемент этой же очереди
+        size_t newCapacity = growCapacity(capacity, size + 1, maxRingCapacity(alloc));
+        T* newData = AllocTraits::allocate(alloc, newCapacity);
+        try {
+            new (newData + size) T(std::forward<Args>(args)...);
+        } catch (...) {
+            AllocTraits::deallocate(alloc, newData, newCapacity);
+            throw;
+        }
+        relocateTo(newData);
+        AllocTraits::deallocate(alloc, data, capacity);
+        data = newData;
+        capacity = newCapacity;
+        head = 0;
         size++;
+        tail = wrap(size);
+        return data[size - 1];
     }
 
-    // Извлечение элемента из начала очереди
+    // Добавление элемента в конец очереди
+    void QPUSH(const T& value) {
+        QEMPLACE(value);
+    }
+
+    void QPUSH(T&& value) {
+        QEMPLACE(std::move(value));
+    }
+
+    // Извлечение элемента из начала очереди: элемент перемещается из буфера
     auto QPOP() -> T {
         if (size == 0) {
             throw out_of_range("Queue is empty!");
         }
-        T value = data[head];
-        head = (head + 1) % capacity;  // Сдвигаем голову по кругу
+        T value = std::move(data[head]);
+        data[head].~T();
+        head = wrap(head + 1);  // Сдвигаем голову по кругу
         size--;
+        shrinkIfNeeded();
         return value;
     }
 
-    // Получение первого элемента без его извлечения
-    auto QGET() const -> T {
+    // Пакетное добавление: одна проверка вместимости и не более двух
+    // копирований подряд (до конца буфера и с его начала)
+    void QPUSH_BATCH(span<const T> items) {
+        const T* source = items.data();
+        size_t count = items.size();
+        if (size + count > capacity) {
+            // items может указывать на элементы этой же очереди, а рост
+            // освобождает старый буфер. Физически непрерывный участок кольца
+            // не обязан быть непрерывным логически (может пересекать head),
+            // поэтому такие элементы сначала копируются во временную очередь
+            bool aliases = count > 0 && less<const T*>()(source, data + capacity)
+                           && less<const T*>()(data, source + count);
+            if (aliases) {
+                Queue staged(count, alloc);
+                staged.QPUSH_BATCH(items);
+                QPUSH_BATCH(span<const T>(staged.data, count));
+                return;
+            }
+            reallocate(growCapacity(capacity, size + count, maxRingCapacity(alloc)));
+        }
+        size_t firstPart = min(count, capacity - tail);
+        uninitialized_copy_n(source, firstPart, data + tail);
+        size += firstPart;
+        tail = wrap(tail + firstPart);
+        uninitialized_copy_n(source + firstPart, count - firstPart, data);
+        size += count - firstPart;
+        tail = wrap(tail + count - firstPart);
+    }
+
+    // Пакетное извлечение в буфер вызывающего в порядке очереди.
+    // Возвращает число извлечённых элементов (не больше out.size())
+    auto QPOP_BATCH(span<T> out) -> size_t {
+        size_t count = min(out.size(), size);
+        size_t firstPart = min(count, capacity - head);
+        move(data + head, data + head + firstPart, out.begin());
+        move(data, data + count - firstPart, out.begin() + firstPart);
+        destroy_n(data + head, firstPart);
+        destroy_n(data, count - firstPart);
+        head = wrap(head + count);
+        size -= count;
+        shrinkIfNeeded();
+        return count;
+    }
+
+    // Политика автоматического уменьшения буфера после QPOP
+    void SetShrinkPolicy(ShrinkPolicy policy) {
+        policy.validate();
+        shrinkPolicy = policy;
+        shrinkIfNeeded();
+    }
+
+    [[nodiscard]] auto GetShrinkPolicy() const -> ShrinkPolicy {
+        return shrinkPolicy;
+    }
+
+    // Уменьшение вместимости до наименьшей степени двойки, вмещающей size
+    void shrink_to_fit() {
+        size_t newCapacity = ringCapacity(size, alloc);
+        if (newCapacity < capacity) {
+            reallocate(newCapacity);
+        }
+    }
+
+    // Получение первого элемента без его извлечения (по ссылке, без копии)
+    auto QGET() -> T& {
+        if (size == 0) {
+            throw out_of_range("Queue is empty!");
+        }
+        return data[head];
+    }
+
+    auto QGET() const -> const T& {
         if (size == 0) {
             throw out_of_range("Queue is empty!");
         }
@@ -129,8 +327,8 @@ class Queue {
         if (size == 0) {
             cout << "пусто";
         } else {
-            for (uint32_t i = 0; i < size; ++i) {
-                cout << data[(head + i) % capacity] << " ";
+            for (size_t i = 0; i < size; ++i) {
+                cout << data[wrap(head + i)] << " ";
             }
         }
         cout << endl;
@@ -138,38 +336,43 @@ class Queue {
 
     // Сохранение очереди в файл
     void QSAVE(const string& filename) const {
-        ofstream file(filename);
+        text_codec::Writer file(filename);
         if (!file.is_open()) {
             throw runtime_error("Error opening file for writing: " + filename);
         }
-        file << size << endl;
-        for (uint32_t i = 0; i < size; i++) {
-            file << data[(head + i) % capacity] << " ";
+        file.write(size);
+        file.put('\n');
+        for (size_t i = 0; i < size; i++) {
+            file.write(data[wrap(head + i)]);
+            file.put(' ');
+        }
+        if (!file.close()) {
+            throw runtime_error("Error writing file: " + filename);
         }
-        file.close();
         cout << "Очередь сохранена в файл: " << filename << endl;
     }
 
     // Загрузка очереди из файла
     void QLOAD(const string& filename) {
-        ifstream file(filename);
+        text_codec::Reader file(filename);
         if (!file.is_open()) {
             throw runtime_error("Error opening file for reading: " + filename);
         }
         
         // Очищаем текущую очередь перед загрузкой
+        destroyElements();
         size = 0;
         head = 0;
         tail = 0;
 
-        uint32_t NewSize = 0;
-        if (!(file >> NewSize)) {
+        size_t NewSize = 0;
+        if (!file.read(NewSize)) {
              throw runtime_error("Error reading queue size from file: " + filename);
         }
 
         T value;
-        while (size < NewSize && file >> value) {
-            QPUSH(value);
+        while (size < NewSize && file.read(value)) {
+            QPUSH(std::move(value));
         }
 
         // Проверка: если файл закончился раньше, чем мы считали NewSize элементов
@@ -181,22 +384,22 @@ class Queue {
         cout << "Очередь загружена из файла: " << filename << endl;
     }
 
-    // Сохранение очереди в бинарный файл
+    // Сохранение очереди в бинарный файл: кольцо записывается не более
+    // чем двумя непрерывными участками (от головы до конца буфера и с начала)
     void QSAVE_BINARY(const string& filename) const {
+        static_assert(is_trivially_copyable_v<T>, "QSAVE_BINARY requires a trivially copyable T");
         ofstream file(filename, ios::binary);
         if (!file.is_open()) {
             throw runtime_error("Error opening file for binary writing: " + filename);
         }
 
-        // Записываем количество элементов (size)
-        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        // Записываем заголовок с 64-битным количеством элементов
+        binary_format::writeHeader(file, size);
+
+        size_t firstPart = min(size, capacity - head);
+        file.write(reinterpret_cast<const char*>(data + head), static_cast<streamsize>(firstPart * sizeof(T)));
+        file.write(reinterpret_cast<const char*>(data), static_cast<streamsize>((size - firstPart) * sizeof(T)));
 
-        // Записываем сами элементы
-        for (uint32_t i = 0; i < size; i++) {
-            const T& item = data[(head + i) % capacity];
-            file.write(reinterpret_cast<const char*>(&item), sizeof(T));
-        }
-        
         if (!file) {
              throw runtime_error("Error writing data to file.");
         }
@@ -205,52 +408,885 @@ class Queue {
         cout << "Очередь сохранена (bin): " << filename << endl;
     }
 
-    // Загрузка очереди из бинарного файла
+    // Загрузка очереди из бинарного файла: буфер выделяется сразу под
+    // весь размер, элементы читаются одним вызовом read
     void QLOAD_BINARY(const string& filename) {
+        static_assert(is_trivially_copyable_v<T>, "QLOAD_BINARY requires a trivially copyable T");
         ifstream file(filename, ios::binary);
         if (!file.is_open()) {
             throw runtime_error("Error opening binary file for reading: " + filename);
         }
 
-        // Сбрасываем текущее состояние очереди
-        size = 0;
-        head = 0;
-        tail = 0;
-        // capacity не сбрасываем, будем расширять при необходимости через QPUSH
-
-        uint32_t newSize = 0;
-        // Считываем количество элементов
-        file.read(reinterpret_cast<char*>(&newSize), sizeof(newSize));
-        
-        if (!file) {
+        uint64_t newSize = 0;
+        // Считываем количество элементов (понимает и старый 32-битный заголовок)
+        if (!binary_format::readHeader(file, newSize)) {
             throw runtime_error("Error reading size (header) from binary file.");
         }
+        if (newSize > maxRingCapacity(alloc)) {
+            throw length_error("Queue size in binary file exceeds max_size()");
+        }
 
-        // Считываем элементы один за другим
-        for (uint32_t i = 0; i < newSize; ++i) {
-            T value;
-            // Считываем сырые байты в переменную value
-            file.read(reinterpret_cast<char*>(&value), sizeof(T));
-            
-            // Если файл оборван или данные повреждены
-            if (!file) {
-                throw runtime_error("Error reading data (file corrupted or shorter than expected).");
-            }
-            
-            QPUSH(value);
+        resetStorage(newSize);
+        file.read(reinterpret_cast<char*>(data), static_cast<streamsize>(newSize * sizeof(T)));
+        // Если файл оборван или данные повреждены
+        if (!file) {
+            throw runtime_error("Error reading data (file corrupted or shorter than expected).");
         }
+        size = newSize;
+        tail = wrap(size);
 
         file.close();
         cout << "Очередь загружена (bin): " << filename << endl;
     }
 
+    // Потоковое добавление из файлового дескриптора (файл, канал, сокет):
+    // сырые элементы без заголовка читаются блоками по streamBlockBytes
+    // прямо в свободный участок кольца за хвостом, пока не кончится поток
+    // или не наберётся maxCount элементов. Для обычного файла буфер
+    // заранее расширяется под остаток файла. Возвращает число добавленных
+    // элементов; поток, оборванный посреди элемента, — ошибка
+    auto QPUSH_FD(int fd, size_t maxCount = SIZE_MAX) -> size_t {
+        static_assert(is_trivially_copyable_v<T>, "QPUSH_FD requires a trivially copyable T");
+#ifdef __linux__
+        struct stat st;
+        if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode)) {
+            off_t position = lseek(fd, 0, SEEK_CUR);
+            if (position >= 0 && st.st_size > position) {
+                size_t expected = min(static_cast<size_t>(st.st_size - position) / sizeof(T), maxCount);
+                if (size + expected > capacity) {
+                    reallocate(ringCapacity(size + expected, alloc));
+                }
+            }
+        }
+
+        const size_t blockElements = max<size_t>(streamBlockBytes / sizeof(T), 1);
+        size_t pushed = 0;
+        size_t partial = 0;  // Уже прочитанные байты незаконченного элемента в ячейке tail
+        while (pushed < maxCount) {
+            if (size == capacity) {
+                reallocate(growCapacity(capacity, size + 1, maxRingCapacity(alloc)));
+            }
+            size_t run = min({capacity - size, capacity - tail, maxCount - pushed, blockElements});
+            char* target = reinterpret_cast<char*>(data + tail) + partial;
+            ssize_t got = read(fd, target, run * sizeof(T) - partial);
+            if (got < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw runtime_error("Error reading from file descriptor.");
+            }
+            if (got == 0) {
+                break;
+            }
+            size_t bytes = partial + static_cast<size_t>(got);
+            size_t complete = bytes / sizeof(T);
+            partial = bytes % sizeof(T);
+            size += complete;
+            tail = wrap(tail + complete);
+            pushed += complete;
+        }
+        if (partial != 0) {
+            throw runtime_error("Error reading from file descriptor: stream ends inside an element.");
+        }
+        return pushed;
+#else
+        (void)fd;
+        (void)maxCount;
+        throw runtime_error("QPUSH_FD is not supported on this platform");
+#endif
+    }
+
     [[nodiscard]] auto empty() const -> bool {
         return size == 0;
     }
 
-    [[nodiscard]] auto GetSize() const -> uint32_t {
+    [[nodiscard]] auto GetSize() const -> size_t {
         return size;
     }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return capacity;
+    }
+};
+
+// Ограниченная lock-free очередь для одного потока-производителя и одного
+// потока-потребителя. head и tail — монотонные счётчики, ячейка берётся по
+// маске (вместимость — степень двойки). Каждый счётчик пишет только один
+// поток и публикует его с release; второй поток читает его с acquire.
+// Чтобы не читать чужую кэш-линию на каждой операции, у каждой стороны
+// есть своя копия счётчика другой стороны, которая обновляется, только
+// когда по ней очередь кажется полной (пустой)
+template <typename T, typename Alloc = allocator<T>>
+class SpscQueue {
+ private:
+    using AllocTraits = allocator_traits<Alloc>;
+
+    // Линия потребителя: head и его копия tail
+    alignas(64) atomic<size_t> head{0};
+    size_t tailCache = 0;
+
+    // Линия производителя: tail и его копия head
+    alignas(64) atomic<size_t> tail{0};
+    size_t headCache = 0;
+
+    // Неизменяемые после конструктора поля — на отдельной линии
+    alignas(64) [[no_unique_address]] Alloc alloc;
+    size_t capacity;
+    T* data;
+
+    static auto ringCapacity(size_t required, const Alloc& allocator) -> size_t {
+        if (required > bit_floor(AllocTraits::max_size(allocator))) {
+            throw length_error("Error: Container size exceeds the allocator's max_size().");
+        }
+        return bit_ceil(max<size_t>(required, 1));
+    }
+
+    [[nodiscard]] auto slot(size_t index) const -> T* {
+        return data + (index & (capacity - 1));
+    }
+
+ public:
+    // Вместимость не меньше cap (округляется вверх до степени двойки)
+    explicit SpscQueue(size_t cap, const Alloc& allocator = Alloc()) : alloc(allocator)
+                                                                     , capacity(ringCapacity(cap, allocator))
+                                                                     , data(AllocTraits::allocate(alloc, capacity)) {}
+
+    ~SpscQueue() {
+        size_t end = tail.load(memory_order_relaxed);
+        for (size_t i = head.load(memory_order_relaxed); i != end; i++) {
+            slot(i)->~T();
+        }
+        AllocTraits::deallocate(alloc, data, capacity);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    auto operator=(const SpscQueue&) -> SpscQueue& = delete;
+
+    // Только поток-производитель: false, если очередь заполнена
+    template <typename... Args>
+    auto QTRY_EMPLACE(Args&&... args) -> bool {
+        size_t t = tail.load(memory_order_relaxed);
+        if (t - headCache == capacity) {
+            headCache = head.load(memory_order_acquire);
+            if (t - headCache == capacity) {
+                return false;
+            }
+        }
+        new (slot(t)) T(std::forward<Args>(args)...);
+        tail.store(t + 1, memory_order_release);
+        return true;
+    }
+
+    auto QTRY_PUSH(const T& value) -> bool {
+        return QTRY_EMPLACE(value);
+    }
+
+    auto QTRY_PUSH(T&& value) -> bool {
+        return QTRY_EMPLACE(std::move(value));
+    }
+
+    // Только поток-потребитель: false, если очередь пуста
+    auto QTRY_POP(T& value) -> bool {
+        size_t h = head.load(memory_order_relaxed);
+        if (h == tailCache) {
+            tailCache = tail.load(memory_order_acquire);
+            if (h == tailCache) {
+                return false;
+            }
+        }
+        T* item = slot(h);
+        value = std::move(*item);
+        item->~T();
+        head.store(h + 1, memory_order_release);
+        return true;
+    }
+
+    // Только поток-производитель: добавляет столько элементов из начала
+    // items, сколько помещается, не более чем двумя копированиями подряд.
+    // Возвращает число добавленных элементов
+    auto QPUSH_BATCH(span<const T> items) -> size_t {
+        size_t t = tail.load(memory_order_relaxed);
+        if (capacity - (t - headCache) < items.size()) {
+            headCache = head.load(memory_order_acquire);
+        }
+        size_t count = min(items.size(), capacity - (t - headCache));
+        size_t firstPart = min(count, capacity - (t & (capacity - 1)));
+        uninitialized_copy_n(items.data(), firstPart, slot(t));
+        if (count > firstPart) {
+            // Первая часть публикуется отдельно: если копирование второй
+            // бросит исключение, уже созданные элементы не потеряются
+            tail.store(t + firstPart, memory_order_release);
+            uninitialized_copy_n(items.data() + firstPart, count - firstPart, data);
+        }
+        tail.store(t + count, memory_order_release);
+        return count;
+    }
+
+    // Только поток-потребитель: извлекает до out.size() элементов в порядке
+    // очереди. Возвращает число извлечённых элементов
+    auto QPOP_BATCH(span<T> out) -> size_t {
+        size_t h = head.load(memory_order_relaxed);
+        if (tailCache - h < out.size()) {
+            tailCache = tail.load(memory_order_acquire);
+        }
+        size_t count = min(out.size(), tailCache - h);
+        size_t firstPart = min(count, capacity - (h & (capacity - 1)));
+        T* first = slot(h);
+        move(first, first + firstPart, out.begin());
+        move(data, data + count - firstPart, out.begin() + firstPart);
+        destroy_n(first, firstPart);
+        destroy_n(data, count - firstPart);
+        head.store(h + count, memory_order_release);
+        return count;
+    }
+
+    // Мгновенный снимок: при одновременных операциях может сразу устареть
+    [[nodiscard]] auto empty() const -> bool {
+        return head.load(memory_order_acquire) == tail.load(memory_order_acquire);
+    }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return capacity;
+    }
+};
+
+// Ограниченная lock-free очередь для нескольких производителей и нескольких
+// потребителей (схема Д. Вьюкова). У каждой ячейки есть номер sequence:
+// sequence == pos — ячейка свободна для записи с позицией pos,
+// sequence == pos + 1 — в ней лежит элемент для чтения с позицией pos.
+// Потоки захватывают позицию CAS на enqueuePos / dequeuePos и дальше
+// работают только со своей ячейкой; потребитель освобождает её, выставляя
+// sequence = pos + capacity — номер записи на следующем круге
+template <typename T, typename Alloc = allocator<T>>
+class MpmcQueue {
+ private:
+    struct Cell {
+        atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        auto value() -> T* {
+            return reinterpret_cast<T*>(storage);
+        }
+    };
+
+    using CellAlloc = typename allocator_traits<Alloc>::template rebind_alloc<Cell>;
+    using CellTraits = allocator_traits<CellAlloc>;
+
+    static constexpr uint32_t spinsBeforeYield = 64;
+
+    alignas(64) atomic<size_t> enqueuePos{0};
+    alignas(64) atomic<size_t> dequeuePos{0};
+
+    alignas(64) [[no_unique_address]] CellAlloc alloc;
+    size_t capacity;
+    Cell* cells;
+
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        this_thread::yield();
+#endif
+    }
+
+    // Ожидание в блокирующих операциях: сначала короткие паузы,
+    // затем процессор уступается другим потокам
+    static void backoff(uint32_t& spins) {
+        if (spins < spinsBeforeYield) {
+            spins++;
+            cpuRelax();
+        } else {
+            this_thread::yield();
+        }
+    }
+
+    // Ячейка для записи; nullptr, если очередь заполнена
+    auto claimForPush() -> pair<Cell*, size_t> {
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        while (true) {
+            Cell* cell = cells + (pos & (capacity - 1));
+            size_t sequence = cell->sequence.load(memory_order_acquire);
+            auto diff = static_cast<ptrdiff_t>(sequence - pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    return {cell, pos};
+                }
+            } else if (diff < 0) {
+                return {nullptr, pos};  // Ячейка ещё занята элементом прошлого круга
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    // Ячейка для чтения; nullptr, если очередь пуста
+    auto claimForPop() -> pair<Cell*, size_t> {
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        while (true) {
+            Cell* cell = cells + (pos & (capacity - 1));
+            size_t sequence = cell->sequence.load(memory_order_acquire);
+            auto diff = static_cast<ptrdiff_t>(sequence - (pos + 1));
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    return {cell, pos};
+                }
+            } else if (diff < 0) {
+                return {nullptr, pos};  // Производитель ещё не записал элемент
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    static auto ringCapacity(size_t required, const CellAlloc& allocator) -> size_t {
+        if (required > bit_floor(CellTraits::max_size(allocator))) {
+            throw length_error("Error: Container size exceeds the allocator's max_size().");
+        }
+        return bit_ceil(max<size_t>(required, 2));
+    }
+
+    auto takeFrom(Cell* cell, size_t pos) -> T {
+        T value = std::move(*cell->value());
+        cell->value()->~T();
+        cell->sequence.store(pos + capacity, memory_order_release);
+        return value;
+    }
+
+ public:
+    // Вместимость не меньше cap и не меньше 2 (округляется до степени двойки)
+    explicit MpmcQueue(size_t cap, const Alloc& allocator = Alloc()) : alloc(allocator)
+                                                                     , capacity(ringCapacity(cap, alloc))
+                                                                     , cells(CellTraits::allocate(alloc, capacity)) {
+        for (size_t i = 0; i < capacity; i++) {
+            Cell* cell = new (cells + i) Cell;
+            cell->sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    ~MpmcQueue() {
+        size_t end = enqueuePos.load(memory_order_relaxed);
+        for (size_t pos = dequeuePos.load(memory_order_relaxed); pos != end; pos++) {
+            cells[pos & (capacity - 1)].value()->~T();
+        }
+        CellTraits::deallocate(alloc, cells, capacity);
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    auto operator=(const MpmcQueue&) -> MpmcQueue& = delete;
+
+    // false, если очередь заполнена
+    template <typename... Args>
+    auto QTRY_EMPLACE(Args&&... args) -> bool {
+        auto [cell, pos] = claimForPush();
+        if (cell == nullptr) {
+            return false;
+        }
+        new (cell->storage) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    auto QTRY_PUSH(const T& value) -> bool {
+        return QTRY_EMPLACE(value);
+    }
+
+    auto QTRY_PUSH(T&& value) -> bool {
+        return QTRY_EMPLACE(std::move(value));
+    }
+
+    // false, если очередь пуста
+    auto QTRY_POP(T& value) -> bool {
+        auto [cell, pos] = claimForPop();
+        if (cell == nullptr) {
+            return false;
+        }
+        value = takeFrom(cell, pos);
+        return true;
+    }
+
+    // Блокирующее добавление: ждёт, пока освободится место
+    void QPUSH(T value) {
+        uint32_t spins = 0;
+        while (!QTRY_PUSH(std::move(value))) {
+            backoff(spins);
+        }
+    }
+
+    // Блокирующее извлечение: ждёт появления элемента
+    auto QPOP() -> T {
+        uint32_t spins = 0;
+        while (true) {
+            auto [cell, pos] = claimForPop();
+            if (cell != nullptr) {
+                return takeFrom(cell, pos);
+            }
+            backoff(spins);
+        }
+    }
+
+    // Мгновенный снимок: при одновременных операциях может сразу устареть
+    [[nodiscard]] auto empty() const -> bool {
+        return dequeuePos.load(memory_order_acquire) >= enqueuePos.load(memory_order_acquire);
+    }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return capacity;
+    }
+};
+
+// Двусторонняя очередь для планировщика с кражей работы (Chase-Lev,
+// в варианте Lê и др. для модели памяти C11). Владелец добавляет и
+// извлекает элементы с нижнего конца (bottom) как из стека — без CAS,
+// пока в очереди больше одного элемента. Другие потоки крадут с верхнего
+// конца (top) через CAS. Кольцо растёт только у владельца; старые кольца
+// не освобождаются до деструктора, потому что вор мог успеть прочитать
+// указатель на них. Элементы читаются вором до CAS, поэтому T должен быть
+// тривиально копируемым (обычно это указатель на задачу)
+template <typename T, typename Alloc = allocator<T>>
+class WorkStealingDeque {
+    static_assert(is_trivially_copyable_v<T>, "WorkStealingDeque requires a trivially copyable T");
+
+ private:
+    struct Ring {
+        size_t capacity;
+        atomic<T>* slots;
+        Ring* previous;  // Меньшее кольцо, из которого копировали при росте
+
+        auto at(int64_t index) -> atomic<T>& {
+            return slots[static_cast<size_t>(index) & (capacity - 1)];
+        }
+    };
+
+    using RingAlloc = typename allocator_traits<Alloc>::template rebind_alloc<Ring>;
+    using SlotAlloc = typename allocator_traits<Alloc>::template rebind_alloc<atomic<T>>;
+
+    alignas(64) atomic<int64_t> top{0};
+    alignas(64) atomic<int64_t> bottom{0};
+    atomic<Ring*> ring{nullptr};
+
+    alignas(64) [[no_unique_address]] Alloc alloc;
+
+    auto makeRing(size_t capacity, Ring* previous) -> Ring* {
+        RingAlloc ringAlloc(alloc);
+        SlotAlloc slotAlloc(alloc);
+        atomic<T>* slots = allocator_traits<SlotAlloc>::allocate(slotAlloc, capacity);
+        for (size_t i = 0; i < capacity; i++) {
+            new (slots + i) atomic<T>();
+        }
+        Ring* created = allocator_traits<RingAlloc>::allocate(ringAlloc, 1);
+        return new (created) Ring{capacity, slots, previous};
+    }
+
+    // Удвоение кольца: элементы [t, b) копируются на те же логические позиции
+    auto grow(Ring* old, int64_t t, int64_t b) -> Ring* {
+        if (old->capacity > bit_floor(allocator_traits<SlotAlloc>::max_size(SlotAlloc(alloc))) / 2) {
+            throw length_error("Error: Container size exceeds the allocator's max_size().");
+        }
+        Ring* bigger = makeRing(old->capacity * 2, old);
+        for (int64_t i = t; i < b; i++) {
+            bigger->at(i).store(old->at(i).load(memory_order_relaxed), memory_order_relaxed);
+        }
+        ring.store(bigger, memory_order_release);
+        return bigger;
+    }
+
+ public:
+    // Начальная вместимость не меньше cap (округляется до степени двойки)
+    explicit WorkStealingDeque(size_t cap = 64, const Alloc& allocator = Alloc()) : alloc(allocator) {
+        ring.store(makeRing(bit_ceil(max<size_t>(cap, 2)), nullptr), memory_order_relaxed);
+    }
+
+    ~WorkStealingDeque() {
+        RingAlloc ringAlloc(alloc);
+        SlotAlloc slotAlloc(alloc);
+        Ring* current = ring.load(memory_order_relaxed);
+        while (current != nullptr) {
+            Ring* previous = current->previous;
+            allocator_traits<SlotAlloc>::deallocate(slotAlloc, current->slots, current->capacity);
+            allocator_traits<RingAlloc>::deallocate(ringAlloc, current, 1);
+            current = previous;
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    auto operator=(const WorkStealingDeque&) -> WorkStealingDeque& = delete;
+
+    // Только владелец: добавление на нижний конец, при нехватке места кольцо удваивается
+    void QPUSH(T value) {
+        int64_t b = bottom.load(memory_order_relaxed);
+        int64_t t = top.load(memory_order_acquire);
+        Ring* current = ring.load(memory_order_relaxed);
+        if (b - t >= static_cast<int64_t>(current->capacity)) {
+            current = grow(current, t, b);
+        }
+        current->at(b).store(value, memory_order_relaxed);
+        bottom.store(b + 1, memory_order_release);
+    }
+
+    // Только владелец: извлечение последнего добавленного элемента.
+    // За последний элемент владелец соревнуется с ворами через CAS на top
+    auto QPOP(T& value) -> bool {
+        int64_t b = bottom.load(memory_order_relaxed) - 1;
+        Ring* current = ring.load(memory_order_relaxed);
+        bottom.store(b, memory_order_seq_cst);
+        int64_t t = top.load(memory_order_seq_cst);
+        if (t > b) {
+            bottom.store(b + 1, memory_order_release);  // Очередь была пуста
+            return false;
+        }
+        value = current->at(b).load(memory_order_relaxed);
+        if (t < b) {
+            return true;
+        }
+        bool won = top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed);
+        bottom.store(b + 1, memory_order_release);
+        return won;
+    }
+
+    // Любой поток: кража самого старого элемента. false, если очередь пуста
+    // или элемент перехватил другой поток (тогда можно повторить попытку)
+    auto QSTEAL(T& value) -> bool {
+        int64_t t = top.load(memory_order_seq_cst);
+        int64_t b = bottom.load(memory_order_seq_cst);
+        if (t >= b) {
+            return false;
+        }
+        T candidate = ring.load(memory_order_acquire)->at(t).load(memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed)) {
+            return false;
+        }
+        value = candidate;
+        return true;
+    }
+
+    // Мгновенный снимок: при одновременных операциях может сразу устареть
+    [[nodiscard]] auto GetSize() const -> size_t {
+        int64_t b = bottom.load(memory_order_seq_cst);
+        int64_t t = top.load(memory_order_seq_cst);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    [[nodiscard]] auto empty() const -> bool {
+        return GetSize() == 0;
+    }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return ring.load(memory_order_acquire)->capacity;
+    }
+};
+
+// Ожидание на 32-битном атомарном слове. На Linux — futex: поток спит в ядре,
+// пока слово равно expected, и просыпается по wake. На других системах —
+// atomic::wait, а ожидание с таймаутом сводится к опросу с уступкой процессора
+namespace futex {
+
+static_assert(sizeof(atomic<uint32_t>) == sizeof(uint32_t), "futex requires a plain 32-bit atomic");
+
+// false, если истёк срок deadline; true — разбудили, слово изменилось
+// или пробуждение ложное (вызывающий всё равно перепроверяет условие)
+inline auto waitUntil(atomic<uint32_t>& word, uint32_t expected, chrono::steady_clock::time_point deadline) -> bool {
+    auto remaining = deadline - chrono::steady_clock::now();
+    if (remaining <= chrono::steady_clock::duration::zero()) {
+        return false;
+    }
+#ifdef __linux__
+    auto seconds = chrono::duration_cast<chrono::seconds>(remaining);
+    timespec timeout{};
+    timeout.tv_sec = static_cast<time_t>(seconds.count());
+    timeout.tv_nsec = static_cast<long>(chrono::duration_cast<chrono::nanoseconds>(remaining - seconds).count());
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, &timeout, nullptr, 0);
+#else
+    if (word.load() == expected) {
+        this_thread::yield();
+    }
+#endif
+    return true;
+}
+
+inline void wait(atomic<uint32_t>& word, uint32_t expected) {
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+    word.wait(expected);
+#endif
+}
+
+inline void wake(atomic<uint32_t>& word, uint32_t count) {
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE,
+            static_cast<int>(min<uint32_t>(count, INT_MAX)), nullptr, nullptr, 0);
+#else
+    if (count == 1) {
+        word.notify_one();
+    } else {
+        word.notify_all();
+    }
+#endif
+}
+
+// Семафор со счётчиком в пространстве пользователя. Пока разрешения есть,
+// wait и signal обходятся одной атомарной операцией без системных вызовов.
+// Отрицательный count — число потоков, ушедших спать; signal(n) выдаёт
+// спящим ровно min(n, спящих) разрешений через слово permits и будит их
+// одним вызовом wake — лишних пробуждений нет
+class Semaphore {
+ private:
+    static constexpr uint32_t spinIterations = 128;
+
+    alignas(64) atomic<int64_t> count;
+    atomic<uint32_t> permits{0};  // Разрешения, выданные спящим; на этом слове они спят
+
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        this_thread::yield();
+#endif
+    }
+
+    // Получение разрешения, выданного спящему; false — истёк срок
+    auto waitPermit(const chrono::steady_clock::time_point* deadline) -> bool {
+        while (true) {
+            uint32_t available = permits.load(memory_order_acquire);
+            while (available > 0) {
+                if (permits.compare_exchange_weak(available, available - 1, memory_order_acquire)) {
+                    return true;
+                }
+            }
+            if (deadline == nullptr) {
+                futex::wait(permits, 0);
+            } else if (!futex::waitUntil(permits, 0, *deadline)) {
+                return false;
+            }
+        }
+    }
+
+ public:
+    explicit Semaphore(int64_t initial = 0) : count(initial) {}
+
+    auto tryWait() -> bool {
+        return tryWaitMany(1) == 1;
+    }
+
+    // Захват до maxCount разрешений без ожидания; возвращает число захваченных
+    auto tryWaitMany(int64_t maxCount) -> int64_t {
+        int64_t current = count.load(memory_order_relaxed);
+        while (current > 0) {
+            int64_t taken = min(current, maxCount);
+            if (count.compare_exchange_weak(current, current - taken, memory_order_acquire, memory_order_relaxed)) {
+                return taken;
+            }
+        }
+        return 0;
+    }
+
+    // Ожидание разрешения: сначала короткое вращение, затем сон на futex.
+    // deadline == nullptr — без срока; false — срок истёк
+    auto wait(const chrono::steady_clock::time_point* deadline = nullptr) -> bool {
+        for (uint32_t i = 0; i < spinIterations; i++) {
+            if (tryWait()) {
+                return true;
+            }
+            cpuRelax();
+        }
+        if (count.fetch_sub(1, memory_order_acquire) > 0) {
+            return true;
+        }
+        if (waitPermit(deadline)) {
+            return true;
+        }
+        // Срок истёк: снимаем себя из числа спящих, если signal ещё
+        // не успел выдать нам разрешение; иначе забираем выданное
+        int64_t current = count.load(memory_order_relaxed);
+        while (current < 0) {
+            if (count.compare_exchange_weak(current, current + 1, memory_order_relaxed)) {
+                return false;
+            }
+        }
+        return waitPermit(nullptr);
+    }
+
+    void signal(int64_t n = 1) {
+        int64_t old = count.fetch_add(n, memory_order_release);
+        int64_t sleeping = old < 0 ? min(-old, n) : 0;
+        if (sleeping > 0) {
+            permits.fetch_add(static_cast<uint32_t>(sleeping), memory_order_release);
+            futex::wake(permits, static_cast<uint32_t>(sleeping));
+        }
+    }
+};
+
+}  // namespace futex
+
+// Результат блокирующих операций BlockingQueue
+enum class QueueStatus {
+    Success,
+    Timeout,  // Истёк срок ожидания
+    Closed    // Очередь закрыта (для извлечения — закрыта и опустошена)
+};
+
+// Ограниченная блокирующая очередь: производители ждут, пока очередь полна,
+// потребители — пока пуста. Элементы хранятся в MpmcQueue, а ожидание
+// построено на двух семафорах: slots (свободные места) и items (элементы).
+// Ждущий поток недолго крутится и засыпает на futex; пакетные операции
+// выдают сразу n разрешений и будят всех нужных спящих одним вызовом.
+// close() запрещает добавление и будит всех ожидающих; оставшиеся элементы
+// можно извлечь, после чего извлечение возвращает QueueStatus::Closed
+template <typename T, typename Alloc = allocator<T>>
+class BlockingQueue {
+ private:
+    using Clock = chrono::steady_clock;
+
+    // После close() оба семафора получают столько разрешений, что
+    // никто больше не засыпает
+    static constexpr int64_t closedPermits = int64_t{1} << 40;
+
+    size_t capacity;  // Точная граница; кольцо может быть больше (степень двойки)
+    MpmcQueue<T, Alloc> ring;
+    futex::Semaphore items{0};
+    futex::Semaphore slots;
+
+    alignas(64) atomic<bool> closed{false};
+    atomic<uint32_t> activePushers{0};  // Производители между проверкой closed и добавлением
+
+    // Место получено, но ячейка кольца может быть ещё занята потребителем,
+    // который получил разрешение раньше и не закончил извлечение
+    template <typename U>
+    void pushReserved(U&& value) {
+        while (!ring.QTRY_PUSH(std::forward<U>(value))) {
+            this_thread::yield();
+        }
+    }
+
+    // Элемент может быть ещё не дописан производителем; false — очередь
+    // закрыта, добавлений в процессе нет и элементов не осталось
+    auto popReserved(T& value) -> bool {
+        while (!ring.QTRY_POP(value)) {
+            if (closed.load(memory_order_seq_cst) && activePushers.load(memory_order_seq_cst) == 0) {
+                return ring.QTRY_POP(value);
+            }
+            this_thread::yield();
+        }
+        return true;
+    }
+
+    template <typename U>
+    auto push(U&& value, const Clock::time_point* deadline, bool blocking) -> QueueStatus {
+        activePushers.fetch_add(1, memory_order_seq_cst);
+        QueueStatus status = QueueStatus::Closed;
+        if (!closed.load(memory_order_seq_cst)) {
+            bool reserved = blocking ? slots.wait(deadline) : slots.tryWait();
+            if (!reserved) {
+                status = QueueStatus::Timeout;
+            } else if (!closed.load(memory_order_seq_cst)) {
+                pushReserved(std::forward<U>(value));
+                items.signal(1);
+                status = QueueStatus::Success;
+            }
+        }
+        activePushers.fetch_sub(1, memory_order_seq_cst);
+        return status;
+    }
+
+    auto pop(T& value, const Clock::time_point* deadline, bool blocking) -> QueueStatus {
+        bool reserved = blocking ? items.wait(deadline) : items.tryWait();
+        if (!reserved) {
+            return QueueStatus::Timeout;
+        }
+        if (!popReserved(value)) {
+            return QueueStatus::Closed;
+        }
+        slots.signal(1);
+        return QueueStatus::Success;
+    }
+
+ public:
+    explicit BlockingQueue(size_t cap, const Alloc& allocator = Alloc()) : capacity(max<size_t>(cap, 1))
+                                                                         , ring(capacity, allocator)
+                                                                         , slots(static_cast<int64_t>(capacity)) {}
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    auto operator=(const BlockingQueue&) -> BlockingQueue& = delete;
+
+    // Неблокирующие операции: false, если очередь полна (пуста) или закрыта
+    auto QTRY_PUSH(T value) -> bool {
+        return push(std::move(value), nullptr, false) == QueueStatus::Success;
+    }
+
+    auto QTRY_POP(T& value) -> bool {
+        return pop(value, nullptr, false) == QueueStatus::Success;
+    }
+
+    // Добавление с ожиданием места: Success или Closed
+    auto QPUSH(T value) -> QueueStatus {
+        return push(std::move(value), nullptr, true);
+    }
+
+    template <typename Rep, typename Period>
+    auto QPUSH_FOR(T value, chrono::duration<Rep, Period> timeout) -> QueueStatus {
+        Clock::time_point deadline = Clock::now() + chrono::duration_cast<Clock::duration>(timeout);
+        return push(std::move(value), &deadline, true);
+    }
+
+    // Извлечение с ожиданием элемента: Success или Closed (закрыта и пуста)
+    auto QPOP(T& value) -> QueueStatus {
+        return pop(value, nullptr, true);
+    }
+
+    template <typename Rep, typename Period>
+    auto QPOP_FOR(T& value, chrono::duration<Rep, Period> timeout) -> QueueStatus {
+        Clock::time_point deadline = Clock::now() + chrono::duration_cast<Clock::duration>(timeout);
+        return pop(value, &deadline, true);
+    }
+
+    // Пакетное добавление без ожидания: столько элементов из начала items,
+    // сколько есть свободных мест; ожидающие потребители будятся одним вызовом
+    auto QPUSH_BATCH(span<const T> values) -> size_t {
+        activePushers.fetch_add(1, memory_order_seq_cst);
+        size_t count = 0;
+        if (!closed.load(memory_order_seq_cst)) {
+            count = static_cast<size_t>(slots.tryWaitMany(static_cast<int64_t>(values.size())));
+            for (size_t i = 0; i < count; i++) {
+                pushReserved(values[i]);
+            }
+            items.signal(static_cast<int64_t>(count));
+        }
+        activePushers.fetch_sub(1, memory_order_seq_cst);
+        return count;
+    }
+
+    // Пакетное извлечение без ожидания: до out.size() элементов
+    auto QPOP_BATCH(span<T> out) -> size_t {
+        size_t reserved = static_cast<size_t>(items.tryWaitMany(static_cast<int64_t>(out.size())));
+        size_t count = 0;
+        while (count < reserved && popReserved(out[count])) {
+            count++;
+        }
+        slots.signal(static_cast<int64_t>(count));
+        return count;
+    }
+
+    // Запрет добавления; все ожидающие просыпаются. Потребители извлекают
+    // оставшиеся элементы, затем получают QueueStatus::Closed
+    void close() {
+        if (!closed.exchange(true, memory_order_seq_cst)) {
+            slots.signal(closedPermits);
+            items.signal(closedPermits);
+        }
+    }
+
+    [[nodiscard]] auto is_closed() const -> bool {
+        return closed.load(memory_order_acquire);
+    }
+
+    // Мгновенный снимок: при одновременных операциях может сразу устареть
+    [[nodiscard]] auto empty() const -> bool {
+        return ring.empty();
+    }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return capacity;
+    }
 };
 
 #endif  // QUEUE_HPP
@@ -0,0 +1,221 @@
+#ifndef SEGMENTED_ARRAY_HPP
+#define SEGMENTED_ARRAY_HPP
+
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+#include <bit>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <type_traits>
+#include <stdexcept>
+#include "allocators.hpp"
+
+using namespace std;
+
+// Сегментированный массив: элементы хранятся в блоках геометрически растущего
+// размера (firstChunk, 2 * firstChunk, 4 * firstChunk, ...), указатели на блоки
+// лежат в таблице фиксированного размера. Рост добавляет новый блок и никогда
+// не переносит уже записанные элементы, поэтому адреса элементов стабильны,
+// а MPUSH_BACK не имеет пиков задержки на копирование всего буфера.
+template <typename T, typename Alloc = allocator<T>>
+class SegmentedArray {
+ private:
+    using AllocTraits = allocator_traits<Alloc>;
+
+    // Размер первого блока — 2^firstChunkLog элементов
+    static constexpr uint32_t firstChunkLog = 4;
+    static constexpr size_t firstChunk = size_t(1) << firstChunkLog;
+    // Блоков достаточно для любого индекса size_t
+    static constexpr uint32_t maxChunks = 64 - firstChunkLog;
+
+    [[no_unique_address]] Alloc alloc;
+    T* chunks[maxChunks];
+    uint32_t chunkCount;  // Количество выделенных блоков
+    size_t size;
+
+    static auto chunkSize(uint32_t chunk) -> size_t {
+        return firstChunk << chunk;
+    }
+
+    // Номер блока и смещение внутри него: блок k хранит индексы
+    // [firstChunk * (2^k - 1), firstChunk * (2^(k+1) - 1))
+    static auto locate(size_t index, uint32_t& chunk) -> size_t {
+        size_t shifted = index + firstChunk;
+        chunk = static_cast<uint32_t>(bit_width(shifted)) - 1 - firstChunkLog;
+        return shifted - chunkSize(chunk);
+    }
+
+    void destroyElements() {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size; i++) {
+                MGET_UNCHECKED(i).~T();
+            }
+        }
+    }
+
+    void releaseChunks() {
+        for (uint32_t k = 0; k < chunkCount; k++) {
+            AllocTraits::deallocate(alloc, chunks[k], chunkSize(k));
+        }
+        chunkCount = 0;
+    }
+
+ public:
+    SegmentedArray() : SegmentedArray(Alloc()) {}
+
+    explicit SegmentedArray(const Alloc& allocator) : alloc(allocator)
+                                                    , chunks{}
+                                                    , chunkCount(0)
+                                                    , size(0) {}
+
+    ~SegmentedArray() {
+        destroyElements();
+        releaseChunks();
+    }
+
+    // Копирующий конструктор
+    SegmentedArray(const SegmentedArray& other)
+        : alloc(AllocTraits::select_on_container_copy_construction(other.alloc))
+        , chunks{}
+        , chunkCount(0)
+        , size(0) {
+        for (size_t i = 0; i < other.size; i++) {
+            MPUSH_BACK(other.MGET_UNCHECKED(i));
+        }
+    }
+
+    // Перемещающий конструктор: таблица блоков переходит целиком
+    SegmentedArray(SegmentedArray&& other) noexcept : alloc(other.alloc)
+                                                    , chunks{}
+                                                    , chunkCount(other.chunkCount)
+                                                    , size(other.size) {
+        for (uint32_t k = 0; k < chunkCount; k++) {
+            chunks[k] = other.chunks[k];
+            other.chunks[k] = nullptr;
+        }
+        other.chunkCount = 0;
+        other.size = 0;
+    }
+
+    // Оператор присваивания (копирование и обмен)
+    auto operator=(SegmentedArray other) -> SegmentedArray& {
+        destroyElements();
+        releaseChunks();
+        alloc = other.alloc;
+        chunkCount = other.chunkCount;
+        size = other.size;
+        for (uint32_t k = 0; k < chunkCount; k++) {
+            chunks[k] = other.chunks[k];
+            other.chunks[k] = nullptr;
+        }
+        other.chunkCount = 0;
+        other.size = 0;
+        return *this;
+    }
+
+    // Добавление элемента в конец; при нехватке места выделяется новый блок
+    void MPUSH_BACK(T value) {
+        uint32_t chunk = 0;
+        size_t offset = locate(size, chunk);
+        if (chunk == chunkCount) {
+            if (chunkCount == maxChunks) {
+                throw length_error("Error: SegmentedArray is full.");
+            }
+            chunks[chunkCount] = AllocTraits::allocate(alloc, chunkSize(chunkCount));
+            chunkCount++;
+        }
+        new (chunks[chunk] + offset) T(std::move(value));
+        size++;
+    }
+
+    // Извлечение последнего элемента; пустые блоки не освобождаются
+    auto MPOP_BACK() -> T {
+        if (size == 0) {
+            throw out_of_range("Error: SegmentedArray is empty.");
+        }
+        T& last = MGET_UNCHECKED(size - 1);
+        T value = std::move(last);
+        last.~T();
+        size--;
+        return value;
+    }
+
+    // Доступ по индексу без проверки границ
+    auto MGET_UNCHECKED(size_t index) -> T& {
+        uint32_t chunk = 0;
+        size_t offset = locate(index, chunk);
+        return chunks[chunk][offset];
+    }
+
+    auto MGET_UNCHECKED(size_t index) const -> const T& {
+        uint32_t chunk = 0;
+        size_t offset = locate(index, chunk);
+        return chunks[chunk][offset];
+    }
+
+    auto operator[](size_t index) -> T& {
+        if (index >= size) {
+            throw out_of_range("Error: Index " + to_string(index)
+            + " is out of bounds (size " + to_string(size) + ").");
+        }
+        return MGET_UNCHECKED(index);
+    }
+
+    auto operator[](size_t index) const -> const T& {
+        if (index >= size) {
+            throw out_of_range("Error: Index " + to_string(index)
+            + " is out of bounds (size " + to_string(size) + ").");
+        }
+        return MGET_UNCHECKED(index);
+    }
+
+    void MSWAP_BY_IND(size_t index, T value) {
+        if (index >= size) {
+            throw out_of_range("Error: Index " + to_string(index) + " is out of bounds for swap.");
+        }
+        MGET_UNCHECKED(index) = std::move(value);
+    }
+
+    // Обход всех элементов по блокам, без пересчёта индекса на каждом шаге
+    template <typename Func>
+    void MFOR_EACH(Func func) const {
+        size_t left = size;
+        for (uint32_t k = 0; k < chunkCount && left > 0; k++) {
+            size_t count = chunkSize(k) < left ? chunkSize(k) : left;
+            for (size_t i = 0; i < count; i++) {
+                func(chunks[k][i]);
+            }
+            left -= count;
+        }
+    }
+
+    void PRINT() const {
+        MFOR_EACH([](const T& value) { cout << value << " "; });
+        cout << endl;
+    }
+
+    // Удаление всех элементов с освобождением блоков
+    void clear() {
+        destroyElements();
+        releaseChunks();
+        size = 0;
+    }
+
+    [[nodiscard]] auto GetSize() const -> size_t {
+        return size;
+    }
+
+    // Суммарная вместимость выделенных блоков
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return chunkCount == 0 ? 0 : firstChunk * ((size_t(1) << chunkCount) - 1);
+    }
+
+    [[nodiscard]] auto GetChunkCount() const -> uint32_t {
+        return chunkCount;
+    }
+};
+
+#endif  // SEGMENTED_ARRAY_HPP
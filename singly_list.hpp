@@ -7,6 +7,7 @@
 #include <sstream>
 #include <string>
 #include <stdexcept> 
+#include "text_codec.hpp"
 
 using namespace std;
 
@@ -269,21 +270,24 @@ class ForwardList {
 
     // Сохранение списка в файл
     void FSAVE(const string& filename) const {
-        ofstream file(filename);
+        text_codec::Writer file(filename);
         if (!file.is_open()) {
             throw runtime_error("Error opening file for writing: " + filename);
         }
         SNode<T>* current = head;
         while (current != nullptr) {
-            file << current->key << " ";
+            file.write(current->key);
+            file.put(' ');
             current = current->next;
         }
-        file.close();
+        if (!file.close()) {
+            throw runtime_error("Error writing file: " + filename);
+        }
     }
 
     // Загрузка списка из файла
     void FLOAD(const string& filename) {
-        ifstream file(filename);
+        text_codec::Reader file(filename);
         if (!file.is_open()) {
              throw runtime_error("Error opening file for reading: " + filename);
         }
@@ -294,7 +298,7 @@ class ForwardList {
 
         T value;
         bool first = true;
-        while (file >> value) {
+        while (file.read(value)) {
             if (first) {
                 FCREATE(value);
                 first = false;
@@ -307,7 +311,7 @@ class ForwardList {
         // Проверка на пустой файл или ошибки чтения
         if (first && file.eof()) {
              // Файл был пуст, список остался пустым.
-        } else if (file.fail() && !file.eof()) {
+        } else if (file.fail()) {
              throw runtime_error("Invalid data format in file.");
         }
     }
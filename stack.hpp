@@ -2,101 +2,267 @@
 #define STACK_HPP
 
 #include <iostream>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <stdexcept>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include "allocators.hpp"
+#include "binary_format.hpp"
+#include "text_codec.hpp"
 
 using namespace std;
 
-template <typename T>
+// Alloc — политика выделения памяти (см. allocators.hpp).
+// InlineCapacity — сколько элементов хранится прямо в объекте стека
+template <typename T, typename Alloc = allocator<T>, uint32_t InlineCapacity = 0>
 class Stack {
  private:
-    T* data;
-    uint32_t capacity;
-    uint32_t size;
-
-    void doubleStack() {  // Удвоение стека при достижении лимита capacity
-        uint32_t cap = capacity;
-        T* newData = new T[cap * 2];
-        capacity = cap * 2;
-        for (uint32_t i = 0; i < size; i++) {
-            newData[i] = data[i];
-        }
-        delete[] data;
+    using AllocTraits = allocator_traits<Alloc>;
+
+    [[no_unique_address]] Alloc alloc;
+    [[no_unique_address]] InlineBuffer<T, InlineCapacity> inlineStorage;
+    T* data;  // Сконструированы только элементы [0, size)
+    size_t capacity;
+    size_t size;
+    ShrinkPolicy shrinkPolicy;  // По умолчанию стек не уменьшается
+
+    // Буфер вместимостью не меньше cap: встроенный, если элементы в нём
+    // помещаются, иначе из аллокатора. В cap записывается фактическая вместимость
+    auto obtain(size_t& cap) -> T* {
+        if (InlineCapacity > 0 && cap <= InlineCapacity) {
+            cap = InlineCapacity;
+            return inlineStorage.get();
+        }
+        return AllocTraits::allocate(alloc, cap);
+    }
+
+    void release(T* ptr, size_t cap) {
+        if (!inlineStorage.contains(ptr)) {
+            AllocTraits::deallocate(alloc, ptr, cap);
+        }
+    }
+
+    // Вызов деструкторов для всех элементов стека
+    void destroyElements() {
+        if constexpr (!is_trivially_destructible_v<T>) {
+            for (size_t i = 0; i < size; i++) {
+                data[i].~T();
+            }
+        }
+    }
+
+    // Перенос элементов [0, size) в неинициализированный буфер newData
+    void relocateTo(T* newData) {
+        if constexpr (is_trivially_copyable_v<T>) {
+            if (size > 0) {
+                memcpy(static_cast<void*>(newData), static_cast<const void*>(data), size * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < size; i++) {
+                new (newData + i) T(std::move_if_noexcept(data[i]));
+                data[i].~T();
+            }
+        }
+    }
+
+    // Перенос элементов в буфер вместимостью newCapacity (не меньше size)
+    void reallocate(size_t newCapacity) {
+        if (inlineStorage.contains(data) && newCapacity <= InlineCapacity) {
+            return;  // Элементы уже во встроенном буфере
+        }
+        T* newData = obtain(newCapacity);
+        relocateTo(newData);
+        release(data, capacity);
+        capacity = newCapacity;
         data = newData;
     }
 
+    void shrinkIfNeeded() {
+        size_t newCapacity = shrinkPolicy.shrinkTo(size, capacity);
+        if (newCapacity < capacity) {
+            reallocate(newCapacity);
+        }
+    }
+
  public:
-    Stack() {
+    Stack() : Stack(Alloc()) {}
+
+    // Конструктор пустого стека с заданным аллокатором
+    explicit Stack(const Alloc& allocator) : alloc(allocator) {
         size = 0;
         capacity = 1;
-        data = new T[capacity];
-        for (uint32_t i = 0; i < capacity; i++) {
-            data[i] = T();
-        }
+        data = obtain(capacity);
     }
 
-    explicit Stack(const uint32_t cap) {  // Конструктор
+    explicit Stack(const size_t cap, const Alloc& allocator = Alloc()) : alloc(allocator) {  // Конструктор
         if (cap == 0) {
             throw invalid_argument("Initial capacity must be greater than 0");
         }
         capacity = cap;
         size = 0;
-        data = new T[capacity];
-        for (uint32_t i = 0; i < capacity; i++) {
-            data[i] = T();
-        }
+        data = obtain(capacity);
     }
 
     ~Stack() {  // Деструктор
-        delete[] data;
+        destroyElements();
+        release(data, capacity);
     }
 
-    Stack(const Stack<T>& other) {  // Копирующий конструктор
+    // Копирующий конструктор
+    Stack(const Stack& other) : alloc(AllocTraits::select_on_container_copy_construction(other.alloc)) {
         capacity = other.capacity;
         size = other.size;
-        data = new T[capacity];
-        for (uint32_t i = 0; i < size; i++) {
-            data[i] = other.data[i];
-        }
+        data = obtain(capacity);
+        uninitialized_copy(other.data, other.data + size, data);
+        shrinkPolicy = other.shrinkPolicy;
     }
 
     // Копирующий оператор присваивания
-    auto operator=(const Stack<T>& other) -> Stack<T>& {
+    auto operator=(const Stack& other) -> Stack& {
         if (this == &other) {  // Защита от a = a
             return *this;
         }
-        delete[] data;
+        destroyElements();
+        release(data, capacity);
+        if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+            alloc = other.alloc;
+        }
 
         capacity = other.capacity;
+        size = 0;
+        data = obtain(capacity);
+        uninitialized_copy(other.data, other.data + other.size, data);
         size = other.size;
-        data = new T[capacity];
-        for (uint32_t i = 0; i < size; i++) {
-            data[i] = other.data[i];
-        }
+        shrinkPolicy = other.shrinkPolicy;
         return *this;
     }
 
-    void SPUSH(T value) {  // Добавление элемента в конец стека
-        if (size >= capacity) {
-            doubleStack();
+    // Конструирование элемента на вершине стека прямо из аргументов
+    template <typename... Args>
+    auto SEMPLACE(Args&&... args) -> T& {
+        if (size < capacity) {
+            T* slot = new (data + size) T(std::forward<Args>(args)...);
+            size++;
+            return *slot;
         }
-        data[size++] = value;
+        // Новый элемент конструируется до переноса старых: args может
+        // ссылаться на элемент этого же стека (s.SPUSH(s.STOP()))
+        size_t newCapacity = growCapacity(capacity, size + 1, AllocTraits::max_size(alloc));
+        T* newData = obtain(newCapacity);
+        try {
+            new (newData + size) T(std::forward<Args>(args)...);
+        } catch (...) {
+            release(newData, newCapacity);
+            throw;
+        }
+        relocateTo(newData);
+        release(data, capacity);
+        capacity = newCapacity;
+        data = newData;
+        size++;
+        return data[size - 1];
     }
 
+    void SPUSH(const T& value) {  // Добавление элемента в конец стека
+        SEMPLACE(value);
+    }
+
+    void SPUSH(T&& value) {
+        SEMPLACE(std::move(value));
+    }
+
+    // Извлечение вершины: элемент перемещается из буфера, а не копируется
     auto SPOP() -> T {
         if (size == 0) {
             throw out_of_range("Stack underflow: cannot pop from an empty stack");
         }
-        T rt = data[size - 1];
+        T rt = std::move(data[size - 1]);
         size--;
+        data[size].~T();
+        shrinkIfNeeded();
         return rt;
     }
 
+    // Доступ к вершине без извлечения
+    auto STOP() -> T& {
+        if (size == 0) {
+            throw out_of_range("Stack is empty: no top element");
+        }
+        return data[size - 1];
+    }
+
+    auto STOP() const -> const T& {
+        if (size == 0) {
+            throw out_of_range("Stack is empty: no top element");
+        }
+        return data[size - 1];
+    }
+
+    // Пакетное добавление: одна проверка вместимости и одно копирование
+    // подряд. items[0] оказывается глубже всех, последний элемент — на вершине
+    void SPUSH_BATCH(span<const T> items) {
+        const T* source = items.data();
+        size_t count = items.size();
+        if (size + count > capacity) {
+            // items может указывать на элементы этого же стека: после
+            // переноса они лежат по тому же смещению в новом буфере
+            bool aliases = count > 0 && !less<const T*>()(source, data) && less<const T*>()(source, data + size);
+            size_t offset = aliases ? static_cast<size_t>(source - data) : 0;
+            reallocate(growCapacity(capacity, size + count, AllocTraits::max_size(alloc)));
+            if (aliases) {
+                source = data + offset;
+            }
+        }
+        uninitialized_copy_n(source, count, data + size);
+        size += count;
+    }
+
+    // Пакетное извлечение в буфер вызывающего: out[i] совпадает с результатом
+    // i-го SPOP. Возвращает число извлечённых элементов (не больше out.size())
+    auto SPOP_BATCH(span<T> out) -> size_t {
+        size_t count = min(out.size(), size);
+        T* first = data + size - count;
+        move(make_reverse_iterator(data + size), make_reverse_iterator(first), out.begin());
+        destroy_n(first, count);
+        size -= count;
+        shrinkIfNeeded();
+        return count;
+    }
+
+    // Политика автоматического уменьшения буфера после SPOP
+    void SetShrinkPolicy(ShrinkPolicy policy) {
+        policy.validate();
+        shrinkPolicy = policy;
+        shrinkIfNeeded();
+    }
+
+    [[nodiscard]] auto GetShrinkPolicy() const -> ShrinkPolicy {
+        return shrinkPolicy;
+    }
+
+    // Уменьшение вместимости до текущего размера
+    void shrink_to_fit() {
+        if (capacity > size) {
+            reallocate(size > 0 ? size : 1);
+        }
+    }
+
     void PRINT() {
-        for (uint32_t i = 0; i < size; i++) {
+        for (size_t i = 0; i < size; i++) {
             cout << data[i] << " ";
         }
         cout << endl;
@@ -104,35 +270,38 @@ class Stack {
 
     // Сохранение стека в файл
     void SSAVE(const string& filename) {
-        ofstream file(filename);
+        text_codec::Writer file(filename);
         if (!file.is_open()) {
             throw runtime_error("Could not open file for writing (" + filename + ")");
         }
-        file << size << endl;
-        for (uint32_t i = 0; i < size; i++) {
-            file << data[i] << " ";
+        file.write(size);
+        file.put('\n');
+        for (size_t i = 0; i < size; i++) {
+            file.write(data[i]);
+            file.put(' ');
+        }
+        if (!file.close()) {
+            throw runtime_error("Failed to write stack to " + filename);
         }
-        file.close();
         cout << "Стек сохранён в файл: " << filename << endl;
     }
 
     // Загрузка стека из файла
     void SLOAD(const string& filename) {
-        ifstream file(filename);
+        text_codec::Reader file(filename);
         if (!file.is_open()) {
             throw runtime_error("Could not open file for reading (" + filename + ")");
         }
-        uint32_t nsize;
-        file >> nsize;
-        
-        if (file.fail()) {
+        size_t nsize;
+        if (!file.read(nsize)) {
              throw runtime_error("Failed to read stack size from " + filename);
         }
 
+        destroyElements();
         size = 0;
         T value;
-        while (size < nsize && file >> value) {
-            SPUSH(value);
+        while (size < nsize && file.read(value)) {
+            SPUSH(std::move(value));
         }
         file.close();
         cout << "Стек загружен из файла: " << filename << endl;
@@ -140,14 +309,15 @@ class Stack {
 
     // Сохранение в бинарный файл
     void SSAVE_BINARY(const string& filename) {
+        static_assert(is_trivially_copyable_v<T>, "SSAVE_BINARY requires a trivially copyable T");
         // Открываем файл с флагом ios::binary
         ofstream file(filename, ios::binary);
         if (!file.is_open()) {
             throw runtime_error("Could not open binary file for writing (" + filename + ")");
         }
 
-        // Записываем размер стека (сколько элементов считывать)
-        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        // Записываем заголовок с 64-битным размером стека
+        binary_format::writeHeader(file, size);
 
         // Записываем массив данных целиком
         // reinterpret_cast преобразует указатель T* в char*, чтобы write мог записать байты
@@ -163,24 +333,30 @@ class Stack {
 
     // Загрузка из бинарного файла
     void SLOAD_BINARY(const string& filename) {
+        static_assert(is_trivially_copyable_v<T>, "SLOAD_BINARY requires a trivially copyable T");
         ifstream file(filename, ios::binary);
         if (!file.is_open()) {
             throw runtime_error("Could not open binary file for reading (" + filename + ")");
         }
 
-        uint32_t newSize = 0;
-        // Читаем размер записанного стека
-        file.read(reinterpret_cast<char*>(&newSize), sizeof(newSize));
-        
-        if (file.fail()) {
+        uint64_t newSize = 0;
+        // Читаем размер записанного стека (понимает и старый 32-битный заголовок)
+        if (!binary_format::readHeader(file, newSize)) {
              throw runtime_error("Failed to read size from binary file");
         }
+        if (newSize > AllocTraits::max_size(alloc)) {
+            throw length_error("Stack size in binary file exceeds max_size()");
+        }
 
         // Если текущей ёмкости (capacity) не хватает, перевыделяем память
+        destroyElements();
+        size = 0;
         if (newSize > capacity) {
-            delete[] data;
-            capacity = newSize; 
-            data = new T[capacity];
+            size_t cap = newSize;
+            T* newData = obtain(cap);
+            release(data, capacity);
+            capacity = cap;
+            data = newData;
         }
 
         // Обновляем размер и читаем данные прямо в память
@@ -195,9 +371,297 @@ class Stack {
         cout << "Стек загружен (bin): " << filename << endl;
     }
 
-    auto GetSize() -> uint32_t {
+    auto GetSize() -> size_t {
         return size;
     }
+
+    [[nodiscard]] auto GetCapacity() const -> size_t {
+        return capacity;
+    }
+};
+
+// Стек, первые N элементов которого хранятся без выделения памяти
+template <typename T, uint32_t N>
+using SmallStack = Stack<T, allocator<T>, N>;
+
+// Безопасное освобождение памяти для lock-free структур (hazard pointers).
+// Поток публикует в своей записи адрес узла, который собирается читать;
+// исключённый из структуры узел откладывается и освобождается, только когда
+// ни одна запись на него не указывает
+namespace hazard_pointers {
+
+inline constexpr size_t maxThreads = 256;
+// Отложенные узлы проверяются пачками: сканирование записей стоит O(maxThreads)
+inline constexpr size_t scanThreshold = 2 * maxThreads;
+
+struct alignas(64) Record {
+    atomic<bool> owned{false};
+    atomic<void*> pointer{nullptr};
+};
+
+inline Record records[maxThreads];
+
+struct Retired {
+    void* pointer;
+    void (*deleter)(void*);
+};
+
+// Узлы, всё ещё защищённые в момент завершения отложившего их потока
+struct Orphans {
+    mutex lock;
+    vector<Retired> nodes;
+
+    ~Orphans() {
+        for (Retired& node : nodes) {
+            node.deleter(node.pointer);
+        }
+    }
+};
+
+inline Orphans orphans;
+
+// Освобождение узлов из retired, на которые не указывает ни одна запись
+inline void scan(vector<Retired>& retired) {
+    vector<void*> hazards;
+    for (Record& record : records) {
+        if (void* pointer = record.pointer.load()) {
+            hazards.push_back(pointer);
+        }
+    }
+    sort(hazards.begin(), hazards.end());
+    auto unprotected = partition(retired.begin(), retired.end(), [&hazards](const Retired& node) {
+        return binary_search(hazards.begin(), hazards.end(), node.pointer);
+    });
+    for (auto it = unprotected; it != retired.end(); ++it) {
+        it->deleter(it->pointer);
+    }
+    retired.erase(unprotected, retired.end());
+}
+
+// Запись и список отложенных узлов текущего потока
+struct ThreadState {
+    Record* record = nullptr;
+    vector<Retired> retired;
+
+    ThreadState() {
+        for (Record& candidate : records) {
+            bool expected = false;
+            if (candidate.owned.compare_exchange_strong(expected, true)) {
+                record = &candidate;
+                return;
+            }
+        }
+        throw runtime_error("Hazard pointers: more than " + to_string(maxThreads) + " threads");
+    }
+
+    ~ThreadState() {
+        record->pointer.store(nullptr);
+        scan(retired);
+        if (!retired.empty()) {
+            lock_guard<mutex> guard(orphans.lock);
+            orphans.nodes.insert(orphans.nodes.end(), retired.begin(), retired.end());
+        }
+        record->owned.store(false);
+    }
+
+    ThreadState(const ThreadState&) = delete;
+    auto operator=(const ThreadState&) -> ThreadState& = delete;
+};
+
+inline auto threadState() -> ThreadState& {
+    thread_local ThreadState state;
+    return state;
+}
+
+// Публикация произвольного адреса в записи текущего потока
+inline void publish(void* pointer) {
+    threadState().record->pointer.store(pointer);
+}
+
+inline void clear() {
+    threadState().record->pointer.store(nullptr, memory_order_release);
+}
+
+// Чтение и защита указателя из source: узел не будет освобождён до clear()
+template <typename Node>
+auto protect(const atomic<Node*>& source) -> Node* {
+    Record* record = threadState().record;
+    Node* node = source.load();
+    while (true) {
+        record->pointer.store(node);
+        Node* again = source.load();
+        if (again == node) {
+            return node;
+        }
+        node = again;
+    }
+}
+
+// Передача исключённого узла на отложенное освобождение
+template <typename Node>
+void retire(Node* node) {
+    ThreadState& state = threadState();
+    state.retired.push_back({node, [](void* pointer) { delete static_cast<Node*>(pointer); }});
+    if (state.retired.size() >= scanThreshold) {
+        unique_lock<mutex> guard(orphans.lock, try_to_lock);
+        if (guard.owns_lock() && !orphans.nodes.empty()) {
+            state.retired.insert(state.retired.end(), orphans.nodes.begin(), orphans.nodes.end());
+            orphans.nodes.clear();
+        }
+        guard = unique_lock<mutex>();
+        scan(state.retired);
+    }
+}
+
+}  // namespace hazard_pointers
+
+// Lock-free стек Трайбера для нескольких потоков. Узлы освобождаются через
+// hazard pointers, поэтому SPOP не обращается к уже удалённой памяти и не
+// страдает от ABA. Elimination = true добавляет массив исключения: при
+// неудачном CAS на вершине встречные SPUSH и SPOP пробуют обменяться
+// значением напрямую, не трогая вершину, — это снимает конкуренцию за неё
+template <typename T, bool Elimination = false>
+class ConcurrentStack {
+ private:
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    struct alignas(64) Exchanger {
+        atomic<Node*> node{nullptr};
+    };
+
+    static constexpr size_t eliminationSlots = 8;
+    static constexpr uint32_t eliminationSpins = 128;
+
+    alignas(64) atomic<Node*> head{nullptr};
+    array<Exchanger, Elimination ? eliminationSlots : 0> exchangers;
+
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        this_thread::yield();
+#endif
+    }
+
+    static auto randomSlot() -> size_t {
+        thread_local uint32_t state = static_cast<uint32_t>(hash<thread::id>()(this_thread::get_id())) | 1;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state % eliminationSlots;
+    }
+
+    // Попытка отдать узел встречному SPOP через массив исключения.
+    // Пока узел выставлен, он защищён hazard pointer: забравший его поток
+    // не сможет освободить память и вернуть тот же адрес в ячейку (ABA)
+    auto tryEliminatePush(Node* node) -> bool {
+        Exchanger& slot = exchangers[randomSlot()];
+        Node* expected = nullptr;
+        hazard_pointers::publish(node);
+        if (!slot.node.compare_exchange_strong(expected, node)) {
+            hazard_pointers::clear();
+            return false;
+        }
+        bool taken = false;
+        for (uint32_t i = 0; i < eliminationSpins && !taken; i++) {
+            taken = slot.node.load(memory_order_acquire) != node;
+            cpuRelax();
+        }
+        if (!taken) {
+            expected = node;
+            taken = !slot.node.compare_exchange_strong(expected, nullptr);
+        }
+        hazard_pointers::clear();
+        return taken;
+    }
+
+    // Попытка забрать узел у встречного SPUSH
+    auto tryEliminatePop() -> Node* {
+        Exchanger& slot = exchangers[randomSlot()];
+        Node* node = slot.node.load(memory_order_acquire);
+        if (node != nullptr && slot.node.compare_exchange_strong(node, nullptr)) {
+            return node;
+        }
+        return nullptr;
+    }
+
+    // Снятие узла с вершины (или из массива исключения); nullptr, если стек пуст
+    auto popNode() -> Node* {
+        while (true) {
+            Node* node = hazard_pointers::protect(head);
+            if (node == nullptr) {
+                hazard_pointers::clear();
+                return nullptr;
+            }
+            // node->next читается под защитой: узел не освобождён
+            if (head.compare_exchange_strong(node, node->next)) {
+                hazard_pointers::clear();
+                return node;
+            }
+            if constexpr (Elimination) {
+                hazard_pointers::clear();
+                if (Node* taken = tryEliminatePop()) {
+                    return taken;
+                }
+            }
+        }
+    }
+
+ public:
+    ConcurrentStack() = default;
+
+    ~ConcurrentStack() {
+        Node* node = head.load(memory_order_relaxed);
+        while (node != nullptr) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    auto operator=(const ConcurrentStack&) -> ConcurrentStack& = delete;
+
+    void SPUSH(T value) {
+        Node* node = new Node{std::move(value), head.load(memory_order_relaxed)};
+        while (!head.compare_exchange_weak(node->next, node, memory_order_release, memory_order_relaxed)) {
+            if constexpr (Elimination) {
+                if (tryEliminatePush(node)) {
+                    return;
+                }
+                node->next = head.load(memory_order_relaxed);
+            }
+        }
+    }
+
+    // Извлечение вершины; false, если стек пуст
+    auto STRY_POP(T& value) -> bool {
+        Node* node = popNode();
+        if (node == nullptr) {
+            return false;
+        }
+        value = std::move(node->value);
+        hazard_pointers::retire(node);
+        return true;
+    }
+
+    auto SPOP() -> T {
+        Node* node = popNode();
+        if (node == nullptr) {
+            throw out_of_range("Stack underflow: cannot pop from an empty stack");
+        }
+        T value = std::move(node->value);
+        hazard_pointers::retire(node);
+        return value;
+    }
+
+    // Мгновенный снимок: при одновременных операциях может сразу устареть
+    [[nodiscard]] auto empty() const -> bool {
+        return head.load() == nullptr;
+    }
 };
 
 #endif  // STACK_HPP
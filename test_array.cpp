@@ -1,8 +1,13 @@
 #define BOOST_TEST_MODULE ArrayTestModule
 #include <boost/test/included/unit_test.hpp>
+#include <atomic>
 #include <string>
 #include <vector>
 #include <cstdio> // для remove
+#include <numeric>
+#include <algorithm>
+#include <random>
+#include <filesystem>
 
 #include "array.hpp" 
 
@@ -110,6 +115,266 @@ BOOST_AUTO_TEST_CASE(ModificationMethods) {
     BOOST_CHECK_THROW(arr.MSWAP_BY_IND(100, 1), out_of_range);
 }
 
+// Тест вставки и удаления диапазонов
+BOOST_AUTO_TEST_CASE(RangeInsertAndErase) {
+    Array<int> arr;
+    for (int i = 0; i < 6; ++i) {
+        arr.MPUSH_BACK(i);  // 0 1 2 3 4 5
+    }
+
+    // Вставка с расширением буфера
+    const int block[] = {10, 11, 12, 13};
+    arr.MPUSH_RANGE_BY_IND(2, block, 4);  // 0 1 10 11 12 13 2 3 4 5
+    BOOST_CHECK_EQUAL(arr.GetSize(), 10);
+    BOOST_CHECK_EQUAL(arr[1], 1);
+    BOOST_CHECK_EQUAL(arr[2], 10);
+    BOOST_CHECK_EQUAL(arr[5], 13);
+    BOOST_CHECK_EQUAL(arr[6], 2);
+    BOOST_CHECK_EQUAL(arr[9], 5);
+
+    // Вставка без расширения, источник внутри самого массива
+    arr.SetCapacity(32);
+    arr.MPUSH_RANGE_BY_IND(0, &arr[6], 3);  // 2 3 4 0 1 10 11 12 13 2 3 4 5
+    BOOST_CHECK_EQUAL(arr.GetSize(), 13);
+    BOOST_CHECK_EQUAL(arr[0], 2);
+    BOOST_CHECK_EQUAL(arr[2], 4);
+    BOOST_CHECK_EQUAL(arr[3], 0);
+    BOOST_CHECK_EQUAL(arr[12], 5);
+
+    // Удаление диапазона
+    arr.MDEL_RANGE(3, 9);  // 2 3 4 2 3 4 5
+    BOOST_CHECK_EQUAL(arr.GetSize(), 7);
+    BOOST_CHECK_EQUAL(arr[3], 2);
+    BOOST_CHECK_EQUAL(arr[6], 5);
+    arr.MDEL_RANGE(2, 2);
+    BOOST_CHECK_EQUAL(arr.GetSize(), 7);
+
+    BOOST_CHECK_THROW(arr.MPUSH_RANGE_BY_IND(8, block, 1), out_of_range);
+    BOOST_CHECK_THROW(arr.MDEL_RANGE(5, 8), out_of_range);
+    BOOST_CHECK_THROW(arr.MDEL_RANGE(4, 3), out_of_range);
+}
+
+// Диапазонные операции для нетривиальных типов
+BOOST_AUTO_TEST_CASE(RangeInsertAndEraseStrings) {
+    Array<string> arr;
+    arr.SetCapacity(16);
+    arr.MPUSH_BACK("a");
+    arr.MPUSH_BACK("b");
+    arr.MPUSH_BACK("c");
+    arr.MPUSH_BACK("d");
+
+    // Хвост длиннее вставки
+    const string shortBlock[] = {"x"};
+    arr.MPUSH_RANGE_BY_IND(1, shortBlock, 1);  // a x b c d
+    // Хвост короче вставки
+    const string longBlock[] = {"p", "q", "r"};
+    arr.MPUSH_RANGE_BY_IND(4, longBlock, 3);  // a x b c p q r d
+
+    const string expected[] = {"a", "x", "b", "c", "p", "q", "r", "d"};
+    BOOST_REQUIRE_EQUAL(arr.GetSize(), 8);
+    for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+        BOOST_CHECK_EQUAL(arr[i], expected[i]);
+    }
+
+    arr.MDEL_RANGE(0, 4);  // p q r d
+    BOOST_CHECK_EQUAL(arr.GetSize(), 4);
+    BOOST_CHECK_EQUAL(arr[0], "p");
+    BOOST_CHECK_EQUAL(arr[3], "d");
+}
+
+// Итераторы, data(), span и доступ без проверки границ
+BOOST_AUTO_TEST_CASE(IterationAndRawAccess) {
+    Array<int> arr;
+    for (int i = 5; i > 0; --i) {
+        arr.MPUSH_BACK(i);  // 5 4 3 2 1
+    }
+
+    int sum = 0;
+    for (int value : arr) {
+        sum += value;
+    }
+    BOOST_CHECK_EQUAL(sum, 15);
+    BOOST_CHECK_EQUAL(arr.end() - arr.begin(), 5);
+
+    // Алгоритмы std работают поверх итераторов
+    sort(arr.begin(), arr.end());
+    BOOST_CHECK_EQUAL(arr[0], 1);
+    BOOST_CHECK_EQUAL(arr[4], 5);
+
+    BOOST_CHECK(arr.data() == &arr[0]);
+    arr.MGET_UNCHECKED(2) = 30;
+    BOOST_CHECK_EQUAL(arr[2], 30);
+
+    const Array<int>& constArr = arr;
+    std::span<const int> view = constArr.span();
+    BOOST_CHECK_EQUAL(view.size(), 5);
+    BOOST_CHECK_EQUAL(accumulate(view.begin(), view.end(), 0), 1 + 2 + 30 + 4 + 5);
+    BOOST_CHECK_EQUAL(constArr.MGET_UNCHECKED(4), 5);
+    BOOST_CHECK_EQUAL(*(constArr.end() - 1), 5);
+}
+
+// Поиск и свёртки сверяются с наивным циклом на каждом наборе инструкций
+template <typename T>
+void checkKernelsAgainstNaive(const Array<T>& arr, T needle, T lo, T hi) {
+    uint32_t naiveFind = arr.GetSize();
+    uint32_t naiveCount = 0;
+    T naiveMin = arr[0];
+    T naiveMax = arr[0];
+    array_simd::SumType<T> naiveSum = 0;
+    vector<T> naiveFiltered;
+    for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+        if (arr[i] == needle) {
+            naiveCount++;
+            if (naiveFind == arr.GetSize()) {
+                naiveFind = i;
+            }
+        }
+        naiveMin = min(naiveMin, arr[i]);
+        naiveMax = max(naiveMax, arr[i]);
+        naiveSum += arr[i];
+        if (arr[i] >= lo && arr[i] <= hi) {
+            naiveFiltered.push_back(arr[i]);
+        }
+    }
+
+    const array_simd::Level levels[] = {array_simd::Level::Scalar, array_simd::Level::SSE4,
+                                         array_simd::Level::AVX2};
+    for (array_simd::Level level : levels) {
+        array_simd::setLevel(level);
+        BOOST_CHECK_EQUAL(arr.MFIND(needle), naiveFind);
+        BOOST_CHECK_EQUAL(arr.MCOUNT(needle), naiveCount);
+        BOOST_CHECK_EQUAL(arr.MMIN(), naiveMin);
+        BOOST_CHECK_EQUAL(arr.MMAX(), naiveMax);
+        BOOST_CHECK_EQUAL(arr.MSUM(), naiveSum);
+        Array<T> filtered = arr.MFILTER_RANGE(lo, hi);
+        BOOST_REQUIRE_EQUAL(filtered.GetSize(), naiveFiltered.size());
+        BOOST_CHECK(equal(filtered.begin(), filtered.end(), naiveFiltered.begin()));
+    }
+    array_simd::setLevel(array_simd::supportedLevel());
+}
+
+BOOST_AUTO_TEST_CASE(SimdSearchAndReduce) {
+    mt19937 gen(42);
+    uniform_int_distribution<int32_t> signedDist(-1000, 1000);
+    uniform_int_distribution<uint32_t> unsignedDist(0, 4000000000u);
+
+    // Размер не кратен ширине вектора, чтобы проверить хвосты
+    Array<int32_t> signedArr;
+    Array<uint32_t> unsignedArr;
+    for (int i = 0; i < 1003; ++i) {
+        signedArr.MPUSH_BACK(signedDist(gen));
+        unsignedArr.MPUSH_BACK(unsignedDist(gen));
+    }
+    checkKernelsAgainstNaive<int32_t>(signedArr, signedArr[517], -100, 250);
+    checkKernelsAgainstNaive<int32_t>(signedArr, 5000, -1000, 1000);
+    checkKernelsAgainstNaive<uint32_t>(unsignedArr, unsignedArr[1000], 100000000u, 3000000000u);
+
+    // Короткий массив обрабатывается только скалярным хвостом
+    Array<int32_t> tiny;
+    tiny.MPUSH_BACK(7);
+    tiny.MPUSH_BACK(-3);
+    checkKernelsAgainstNaive<int32_t>(tiny, -3, 0, 10);
+}
+
+// Типы без векторных ядер используют скалярную реализацию
+BOOST_AUTO_TEST_CASE(ScalarFallbackAndEmpty) {
+    Array<string> words;
+    words.MPUSH_BACK("pear");
+    words.MPUSH_BACK("apple");
+    words.MPUSH_BACK("plum");
+    words.MPUSH_BACK("apple");
+    BOOST_CHECK_EQUAL(words.MFIND("apple"), 1);
+    BOOST_CHECK_EQUAL(words.MFIND("kiwi"), words.GetSize());
+    BOOST_CHECK_EQUAL(words.MCOUNT("apple"), 2);
+    BOOST_CHECK_EQUAL(words.MMIN(), "apple");
+    BOOST_CHECK_EQUAL(words.MMAX(), "plum");
+    Array<string> ranged = words.MFILTER_RANGE("b", "pf");
+    BOOST_REQUIRE_EQUAL(ranged.GetSize(), 1);
+    BOOST_CHECK_EQUAL(ranged[0], "pear");
+
+    Array<double> values;
+    values.MPUSH_BACK(1.5);
+    values.MPUSH_BACK(2.5);
+    BOOST_CHECK_CLOSE(values.MSUM(), 4.0, 0.001);
+    Array<double> big = values.MFILTER([](double v) { return v > 2.0; });
+    BOOST_REQUIRE_EQUAL(big.GetSize(), 1);
+    BOOST_CHECK_CLOSE(big[0], 2.5, 0.001);
+
+    Array<int> empty;
+    BOOST_CHECK_THROW(empty.MMIN(), out_of_range);
+    BOOST_CHECK_THROW(empty.MMAX(), out_of_range);
+    BOOST_CHECK_EQUAL(empty.MSUM(), 0);
+    BOOST_CHECK_EQUAL(empty.MFIND(1), 0);
+    BOOST_CHECK_EQUAL(empty.MFILTER_RANGE(0, 10).GetSize(), 0);
+}
+
+// Параллельная сортировка слиянием и поразрядная сортировка
+BOOST_AUTO_TEST_CASE(SortEngines) {
+    mt19937 gen(7);
+    uniform_int_distribution<int32_t> dist(-1000000, 1000000);
+    // Размер больше порога параллельной сортировки
+    const uint32_t n = 100003;
+    Array<int32_t> original;
+    for (uint32_t i = 0; i < n; ++i) {
+        original.MPUSH_BACK(dist(gen));
+    }
+    vector<int32_t> expected(original.begin(), original.end());
+    sort(expected.begin(), expected.end());
+
+    for (uint32_t threads : {1u, 2u, 3u, 8u}) {
+        Array<int32_t> arr(original);
+        arr.MSORT(threads);
+        BOOST_CHECK(equal(arr.begin(), arr.end(), expected.begin()));
+    }
+
+    Array<int32_t> radix(original);
+    radix.MRADIX_SORT();
+    BOOST_CHECK(equal(radix.begin(), radix.end(), expected.begin()));
+
+    // Беззнаковые и 64-битные ключи
+    Array<uint64_t> wide;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        wide.MPUSH_BACK((static_cast<uint64_t>(gen()) << 32) | gen());
+    }
+    wide.MRADIX_SORT();
+    BOOST_CHECK(is_sorted(wide.begin(), wide.end()));
+
+    // Пользовательский компаратор и нетривиальный тип
+    Array<string> words;
+    words.MPUSH_BACK("pear");
+    words.MPUSH_BACK("apple");
+    words.MPUSH_BACK("fig");
+    words.MSORT_BY([](const string& a, const string& b) { return a.size() < b.size(); }, 2);
+    BOOST_CHECK_EQUAL(words[0], "fig");
+    BOOST_CHECK_EQUAL(words[2], "apple");
+
+    Array<int> empty;
+    empty.MSORT();
+    empty.MRADIX_SORT();
+    BOOST_CHECK_EQUAL(empty.GetSize(), 0);
+
+    // Исключение компаратора пробрасывается из MSORT_BY, а не завершает
+    // программу: и при сортировке блоков, и в последнем раунде слияния
+    atomic<uint64_t> compares{0};
+    Array<int32_t> counted(original);
+    counted.MSORT_BY([&compares](int32_t a, int32_t b) {
+        compares.fetch_add(1, memory_order_relaxed);
+        return a < b;
+    }, 4);
+    uint64_t total = compares.load();
+    for (uint64_t failAt : {uint64_t{1}, total - 10}) {
+        atomic<uint64_t> calls{0};
+        Array<int32_t> failing(original);
+        BOOST_CHECK_THROW(failing.MSORT_BY([&calls, failAt](int32_t a, int32_t b) {
+            if (calls.fetch_add(1, memory_order_relaxed) + 1 == failAt) {
+                throw runtime_error("comparator failed");
+            }
+            return a < b;
+        }, 4), runtime_error);
+        BOOST_CHECK_EQUAL(failing.GetSize(), n);
+    }
+}
+
 // Тест конструктора копирования и оператора присваивания
 BOOST_AUTO_TEST_CASE(CopyAndAssign) {
     Array<int> original;
@@ -138,6 +403,240 @@ BOOST_AUTO_TEST_CASE(CopyAndAssign) {
     BOOST_CHECK_EQUAL(assigned[0], 10);
 }
 
+// Тест перемещающего конструктора и оператора присваивания
+BOOST_AUTO_TEST_CASE(MoveConstructAndAssign) {
+    Array<string> original;
+    original.MPUSH_BACK("first string that does not fit into SSO");
+    original.MPUSH_BACK("second");
+
+    Array<string> moved(std::move(original));
+    BOOST_CHECK_EQUAL(moved.GetSize(), 2);
+    BOOST_CHECK_EQUAL(moved[0], "first string that does not fit into SSO");
+    BOOST_CHECK_EQUAL(original.GetSize(), 0);
+
+    // Перемещённый объект остаётся пригодным для использования
+    original.MPUSH_BACK("again");
+    BOOST_CHECK_EQUAL(original.GetSize(), 1);
+    BOOST_CHECK_EQUAL(original[0], "again");
+
+    Array<string> assigned;
+    assigned.MPUSH_BACK("old");
+    assigned = std::move(moved);
+    BOOST_CHECK_EQUAL(assigned.GetSize(), 2);
+    BOOST_CHECK_EQUAL(assigned[1], "second");
+    BOOST_CHECK_EQUAL(moved.GetSize(), 0);
+}
+
+// Счётчик конструирований для проверки стратегии роста
+struct Tracked {
+    static int defaultCtors;
+    static int copies;
+    static int moves;
+    static int alive;
+    int value;
+
+    Tracked() : value(0) { defaultCtors++; alive++; }
+    explicit Tracked(int v) : value(v) { alive++; }
+    Tracked(const Tracked& other) : value(other.value) { copies++; alive++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { moves++; alive++; }
+    auto operator=(const Tracked& other) -> Tracked& { value = other.value; copies++; return *this; }
+    auto operator=(Tracked&& other) noexcept -> Tracked& { value = other.value; moves++; return *this; }
+    ~Tracked() { alive--; }
+
+    static void reset() { defaultCtors = copies = moves = 0; }
+};
+int Tracked::defaultCtors = 0;
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+int Tracked::alive = 0;
+
+// Рост массива не конструирует лишних элементов и не копирует их
+BOOST_AUTO_TEST_CASE(GrowthMovesWithoutDefaultConstruction) {
+    {
+        Array<Tracked> arr;
+        Tracked::reset();
+        for (int i = 0; i < 100; ++i) {
+            arr.MPUSH_BACK(Tracked(i));
+        }
+        BOOST_CHECK_EQUAL(Tracked::defaultCtors, 0);
+        BOOST_CHECK_EQUAL(Tracked::copies, 0);
+        BOOST_CHECK_EQUAL(arr.GetSize(), 100);
+        for (uint32_t i = 0; i < arr.GetSize(); ++i) {
+            BOOST_CHECK_EQUAL(arr[i].value, static_cast<int>(i));
+        }
+
+        arr.MPUSH_BY_IND(50, Tracked(-1));
+        arr.MDEL_BY_IND(0);
+        BOOST_CHECK_EQUAL(Tracked::copies, 0);
+        BOOST_CHECK_EQUAL(arr[49].value, -1);
+        BOOST_CHECK_EQUAL(arr.GetSize(), 100);
+    }
+    // Все созданные объекты уничтожены
+    BOOST_CHECK_EQUAL(Tracked::alive, 0);
+
+    // SetSize конструирует и уничтожает элементы
+    {
+        Array<Tracked> arr;
+        arr.SetCapacity(8);
+        arr.SetSize(5);
+        BOOST_CHECK_EQUAL(Tracked::alive, 5);
+        arr.SetSize(2);
+        BOOST_CHECK_EQUAL(Tracked::alive, 2);
+    }
+    BOOST_CHECK_EQUAL(Tracked::alive, 0);
+}
+
+// Тест обмена содержимым
+BOOST_AUTO_TEST_CASE(SwapContents) {
+    Array<string> a;
+    a.MPUSH_BACK("a1");
+    a.MPUSH_BACK("a2");
+    Array<string> b;
+    b.MPUSH_BACK("b1");
+    const string* bData = b.data();
+
+    a.swap(b);
+    BOOST_CHECK_EQUAL(a.GetSize(), 1);
+    BOOST_CHECK_EQUAL(a[0], "b1");
+    BOOST_CHECK_EQUAL(a.data(), bData);  // Буфер переехал без копирования
+    BOOST_CHECK_EQUAL(b.GetSize(), 2);
+    BOOST_CHECK_EQUAL(b[1], "a2");
+
+    swap(a, b);
+    BOOST_CHECK_EQUAL(a[0], "a1");
+    BOOST_CHECK_EQUAL(b[0], "b1");
+}
+
+// Тест встроенного буфера малой вместимости
+BOOST_AUTO_TEST_CASE(InlineStorage) {
+    SmallArray<string, 4> arr;
+    BOOST_CHECK_EQUAL(arr.GetCapacity(), 4);
+    const string* inlineData = arr.data();
+    for (int i = 0; i < 4; ++i) {
+        arr.MPUSH_BACK(to_string(i));
+    }
+    BOOST_CHECK_EQUAL(arr.data(), inlineData);  // Пока всё помещается, буфер встроенный
+
+    // Копия и перемещение встроенного массива
+    SmallArray<string, 4> copy = arr;
+    BOOST_CHECK_EQUAL(copy[3], "3");
+    SmallArray<string, 4> moved = std::move(copy);
+    BOOST_CHECK_EQUAL(moved.GetSize(), 4);
+    BOOST_CHECK_EQUAL(moved[0], "0");
+    BOOST_CHECK_EQUAL(copy.GetSize(), 0);
+    copy.MPUSH_BACK("reused");
+    BOOST_CHECK_EQUAL(copy[0], "reused");
+
+    // Переполнение переносит элементы в динамическую память
+    arr.MPUSH_BACK("4");
+    BOOST_CHECK(arr.data() != inlineData);
+    BOOST_CHECK_EQUAL(arr.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(arr[4], "4");
+
+    // Обмен встроенного массива с динамическим
+    swap(arr, moved);
+    BOOST_CHECK_EQUAL(arr.GetSize(), 4);
+    BOOST_CHECK_EQUAL(moved.GetSize(), 5);
+    BOOST_CHECK_EQUAL(moved[4], "4");
+
+    // Уменьшение вместимости возвращает элементы во встроенный буфер
+    moved.MDEL_RANGE(2, 5);
+    moved.SetCapacity(2);
+    BOOST_CHECK_EQUAL(moved.GetCapacity(), 4);
+    BOOST_CHECK_EQUAL(moved[1], "1");
+}
+
+// Тест пользовательских аллокаторов
+BOOST_AUTO_TEST_CASE(CustomAllocators) {
+    Arena arena(4096);
+    {
+        Array<int, ArenaAllocator<int>> arr{ArenaAllocator<int>(arena)};
+        for (int i = 0; i < 1000; i++) {
+            arr.MPUSH_BACK(i);
+        }
+        BOOST_CHECK_EQUAL(arr.GetSize(), 1000);
+        BOOST_CHECK_EQUAL(arr[999], 999);
+        BOOST_CHECK(arena.GetBytesUsed() >= 1000 * sizeof(int));
+
+        // Копия разделяет арену исходного массива
+        Array<int, ArenaAllocator<int>> copy = arr;
+        BOOST_CHECK(copy.GetAllocator() == arr.GetAllocator());
+        BOOST_CHECK_EQUAL(copy[500], 500);
+    }
+
+    // Буфер больше порога отображается через mmap
+    Array<int, HugePageAllocator<int>> big;
+    const int count = 1 << 20;
+    for (int i = 0; i < count; i++) {
+        big.MPUSH_BACK(i);
+    }
+    BOOST_CHECK_EQUAL(big.GetSize(), count);
+    BOOST_CHECK_EQUAL(big[count - 1], count - 1);
+    BOOST_CHECK_EQUAL(big.MSUM(), int64_t(count) * (count - 1) / 2);
+}
+
+// Тест политики уменьшения буфера и shrink_to_fit
+BOOST_AUTO_TEST_CASE(ShrinkPolicyTest) {
+    Array<string> arr;
+    for (int i = 0; i < 1000; i++) {
+        arr.MPUSH_BACK(to_string(i));
+    }
+    arr.MDEL_RANGE(10, 1000);
+    BOOST_CHECK_EQUAL(arr.GetCapacity(), 1024);  // Без политики буфер не уменьшается
+
+    arr.SetShrinkPolicy(ShrinkPolicy::Quarter());
+    BOOST_CHECK_EQUAL(arr.GetCapacity(), 32);
+    BOOST_CHECK_EQUAL(arr[9], "9");
+    for (int i = 0; i < 8; i++) {
+        arr.MDEL_BY_IND(0);
+    }
+    BOOST_CHECK_EQUAL(arr.GetCapacity(), 16);  // Не меньше minCapacity
+    BOOST_CHECK_EQUAL(arr[1], "9");
+
+    Array<string> copy = arr;
+    BOOST_CHECK_EQUAL(copy.GetShrinkPolicy().divisor, 4);
+    copy.shrink_to_fit();
+    BOOST_CHECK_EQUAL(copy.GetCapacity(), 2);
+    BOOST_CHECK_EQUAL(copy[0], "8");
+
+    SmallArray<int, 8> small;
+    small.MPUSH_BACK(1);
+    small.shrink_to_fit();
+    BOOST_CHECK_EQUAL(small.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(small[0], 1);
+
+    // Частично заполненный массив: политика без гистерезиса отвергается,
+    // допустимая не сжимает буфер меньше size
+    Array<int> part;
+    for (int i = 0; i < 10; i++) {
+        part.MPUSH_BACK(i);
+    }
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 16);
+    BOOST_CHECK_THROW(part.SetShrinkPolicy(ShrinkPolicy{1, 4}), invalid_argument);
+    BOOST_CHECK_THROW(part.SetShrinkPolicy(ShrinkPolicy{2, 4}), invalid_argument);
+    BOOST_CHECK_EQUAL(part.GetShrinkPolicy().divisor, 0);
+    part.SetShrinkPolicy(ShrinkPolicy{3, 4});
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 16);
+    part.MDEL_RANGE(4, 10);
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(part.MSUM(), 6);
+
+    // Политика переносится перемещением и обменом (в том числе со встроенным буфером)
+    Array<int> moved;
+    moved = std::move(part);
+    BOOST_CHECK_EQUAL(moved.GetShrinkPolicy().divisor, 3);
+    Array<int> other;
+    moved.swap(other);
+    BOOST_CHECK_EQUAL(other.GetShrinkPolicy().divisor, 3);
+    BOOST_CHECK_EQUAL(moved.GetShrinkPolicy().divisor, 0);
+    SmallArray<int, 8> smallA;
+    SmallArray<int, 8> smallB;
+    smallA.SetShrinkPolicy(ShrinkPolicy::Quarter());
+    smallA.swap(smallB);
+    BOOST_CHECK_EQUAL(smallA.GetShrinkPolicy().divisor, 0);
+    BOOST_CHECK_EQUAL(smallB.GetShrinkPolicy().divisor, 4);
+}
+
 // Сеттеры
 BOOST_AUTO_TEST_CASE(SettersLogic) {
     Array<int> arr;
@@ -169,6 +668,8 @@ BOOST_AUTO_TEST_CASE(TextFileIO) {
         arrOut.MPUSH_BACK(200);
         arrOut.MSAVE(filename);
         BOOST_CHECK_THROW(arrOut.MSAVE(badFile), runtime_error);
+        // Файл открывается, но запись не удаётся: нет места на устройстве
+        BOOST_CHECK_THROW(arrOut.MSAVE("/dev/full"), runtime_error);
     }
 
     Array<int> arrIn;
@@ -209,4 +710,219 @@ BOOST_AUTO_TEST_CASE(BinaryFileIO) {
     BOOST_CHECK_THROW(arrIn.MLOAD_BINARY("non_existent_bin.bin"), runtime_error);
 }
 
+// Тест отображения бинарного файла в память
+BOOST_AUTO_TEST_CASE(MappedBinaryLoad) {
+    string filename = "test_array_map.bin";
+    {
+        Array<int> arrOut;
+        for (int i = 0; i < 5000; i++) {
+            arrOut.MPUSH_BACK(i * 3);
+        }
+        arrOut.MSAVE_BINARY(filename);
+    }
+
+    {
+        Array<int> view;
+        view.MMAP_BINARY(filename);
+        BOOST_CHECK(view.IsMapped());
+        BOOST_CHECK_EQUAL(view.GetSize(), 5000);
+        BOOST_CHECK_EQUAL(view[4999], 4999 * 3);
+        BOOST_CHECK_EQUAL(view.MFIND(300), 100);
+
+        // Копия и рост массива переносят элементы в обычную память
+        Array<int> copy = view;
+        BOOST_CHECK(!copy.IsMapped());
+        view.MPUSH_BACK(-1);
+        BOOST_CHECK(!view.IsMapped());
+        BOOST_CHECK_EQUAL(view[4999], 4999 * 3);
+        BOOST_CHECK_EQUAL(view[5000], -1);
+    }
+
+    {
+        // Изменения в режиме копирования при записи не попадают в файл
+        Array<int> cow;
+        cow.MMAP_BINARY(filename, MapMode::CopyOnWrite, true);
+        cow[0] = 42;
+        cow.MSORT(1);
+        BOOST_CHECK_EQUAL(cow[4999], 4999 * 3);
+
+        Array<int> check;
+        check.MMAP_BINARY(filename);
+        BOOST_CHECK_EQUAL(check[0], 0);
+
+        // Перемещение передаёт отображение вместе с буфером
+        Array<int> moved = std::move(check);
+        BOOST_CHECK(moved.IsMapped());
+        moved.MLOAD_BINARY(filename);
+        BOOST_CHECK(!moved.IsMapped());
+        BOOST_CHECK_EQUAL(moved[1], 3);
+    }
+
+    cleanFile(filename);
+    Array<int> arr;
+    BOOST_CHECK_THROW(arr.MMAP_BINARY("non_existent_bin.bin"), runtime_error);
+}
+
+// Изменяющие методы на отображении только для чтения сначала копируют
+// элементы в обычную память, а не пишут в страницы файла
+BOOST_AUTO_TEST_CASE(MappedReadOnlyMutation) {
+    string filename = "test_array_map_ro.bin";
+    string textFile = "test_array_map_ro.txt";
+    {
+        Array<int> arrOut;
+        for (int i = 0; i < 1000; i++) {
+            arrOut.MPUSH_BACK(1000 - i);
+        }
+        arrOut.MSAVE_BINARY(filename);
+        Array<int> small;
+        small.MPUSH_BACK(7);
+        small.MPUSH_BACK(8);
+        small.MSAVE(textFile);
+    }
+
+    Array<int> view;
+    view.MMAP_BINARY(filename);
+    view.MDEL_BY_IND(0);
+    BOOST_CHECK(!view.IsMapped());
+    BOOST_CHECK_EQUAL(view.GetSize(), 999);
+    BOOST_CHECK_EQUAL(view[0], 999);
+
+    view.MMAP_BINARY(filename);
+    view.MSWAP_BY_IND(0, -5);
+    BOOST_CHECK(!view.IsMapped());
+    BOOST_CHECK_EQUAL(view[0], -5);
+
+    view.MMAP_BINARY(filename);
+    view.MSORT(1);
+    BOOST_CHECK_EQUAL(view[0], 1);
+    view.MMAP_BINARY(filename);
+    view.MRADIX_SORT();
+    BOOST_CHECK_EQUAL(view[999], 1000);
+
+    view.MMAP_BINARY(filename);
+    view.MDEL_RANGE(10, 20);
+    BOOST_CHECK_EQUAL(view[10], 980);
+
+    view.MMAP_BINARY(filename);
+    view.SetSize(10);
+    view.MPUSH_BACK(77);
+    BOOST_CHECK_EQUAL(view[10], 77);
+
+    view.MMAP_BINARY(filename);
+    view.MLOAD(textFile);
+    BOOST_CHECK(!view.IsMapped());
+    BOOST_REQUIRE_EQUAL(view.GetSize(), 2);
+    BOOST_CHECK_EQUAL(view[1], 8);
+
+    // Файл на диске не изменился
+    Array<int> check;
+    check.MMAP_BINARY(filename);
+    BOOST_CHECK_EQUAL(check[0], 1000);
+    BOOST_CHECK_EQUAL(check.GetSize(), 1000);
+
+    cleanFile(filename);
+    cleanFile(textFile);
+}
+
+// Проверка MSAVE_COMPRESSED / MLOAD_COMPRESSED на одном наборе данных
+template <typename T>
+void checkCompressedRoundTrip(const Array<T>& arr, const string& filename) {
+    arr.MSAVE_COMPRESSED(filename);
+    Array<T> loaded;
+    loaded.MPUSH_BACK(T(1));  // Старое содержимое должно замениться
+    loaded.MLOAD_COMPRESSED(filename);
+    BOOST_REQUIRE_EQUAL(loaded.GetSize(), arr.GetSize());
+    BOOST_CHECK(equal(arr.begin(), arr.end(), loaded.begin()));
+}
+
+// Тест сжатого бинарного формата: отсортированные, случайные и узкие данные
+BOOST_AUTO_TEST_CASE(CompressedBinaryFileIO) {
+    const string filename = "test_array_compressed.bin";
+    mt19937 gen(7);
+
+    Array<int> sorted;
+    for (int i = 0; i < 300007; ++i) {  // Больше array_codec::chunkValues
+        sorted.MPUSH_BACK(i * 3 - 50000);
+    }
+    checkCompressedRoundTrip(sorted, filename);
+    ifstream sortedFile(filename, ios::binary | ios::ate);
+    BOOST_CHECK(static_cast<size_t>(sortedFile.tellg()) < sorted.GetSize() * sizeof(int) / 4);
+
+    Array<uint32_t> random;
+    Array<int> smallRange;
+    Array<int64_t> wide;
+    Array<int16_t> shorts;
+    for (int i = 0; i < 10000; ++i) {
+        random.MPUSH_BACK(static_cast<uint32_t>(gen()));
+        smallRange.MPUSH_BACK(static_cast<int>(gen() % 1000) - 500);
+        wide.MPUSH_BACK(static_cast<int64_t>(gen()) * (i % 2 == 0 ? -65536 : 1) + INT64_MAX / (i + 1));
+        shorts.MPUSH_BACK(static_cast<int16_t>(gen()));
+    }
+    random.MPUSH_BACK(0);
+    random.MPUSH_BACK(UINT32_MAX);
+    smallRange.MPUSH_BACK(INT32_MIN);  // Блок с полной шириной 32 бита
+    checkCompressedRoundTrip(random, filename);
+    checkCompressedRoundTrip(smallRange, filename);
+    checkCompressedRoundTrip(wide, filename);
+    checkCompressedRoundTrip(shorts, filename);
+    checkCompressedRoundTrip(Array<int>(), filename);
+
+    // Файл другого типа элементов и несжатый файл не читаются как сжатые
+    wide.MSAVE_COMPRESSED(filename);
+    BOOST_CHECK_THROW(sorted.MLOAD_COMPRESSED(filename), runtime_error);
+    sorted.MSAVE_BINARY(filename);
+    BOOST_CHECK_THROW(sorted.MLOAD_COMPRESSED(filename), runtime_error);
+
+    // Обрезанный файл
+    sorted.MSAVE_COMPRESSED(filename);
+    filesystem::resize_file(filename, filesystem::file_size(filename) - 10);
+    BOOST_CHECK_THROW(sorted.MLOAD_COMPRESSED(filename), runtime_error);
+    cleanFile(filename);
+}
+
+// Тест 64-битного заголовка бинарного формата и чтения старых файлов
+BOOST_AUTO_TEST_CASE(BinaryHeaderCompatibility) {
+    const string filename = "test_array_header.bin";
+    {
+        Array<int> arr;
+        arr.MPUSH_BACK(7);
+        arr.MSAVE_BINARY(filename);
+        ifstream file(filename, ios::binary | ios::ate);
+        BOOST_CHECK_EQUAL(static_cast<size_t>(file.tellg()), binary_format::headerBytes + sizeof(int));
+    }
+
+    // Файл старого формата: uint32 size и сразу элементы
+    {
+        ofstream file(filename, ios::binary);
+        uint32_t legacySize = 3;
+        int values[] = {10, 20, 30};
+        file.write(reinterpret_cast<const char*>(&legacySize), sizeof(legacySize));
+        file.write(reinterpret_cast<const char*>(values), sizeof(values));
+    }
+    Array<int> loaded;
+    loaded.MLOAD_BINARY(filename);
+    BOOST_CHECK_EQUAL(loaded.GetSize(), 3);
+    BOOST_CHECK_EQUAL(loaded[2], 30);
+    Array<int> mapped;
+    mapped.MMAP_BINARY(filename);
+    BOOST_CHECK_EQUAL(mapped.GetSize(), 3);
+    BOOST_CHECK_EQUAL(mapped[0], 10);
+
+    // Неизвестная версия формата не читается
+    {
+        ofstream file(filename, ios::binary);
+        uint32_t header[] = {binary_format::marker, binary_format::version + 1, 0, 0};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    }
+    BOOST_CHECK_THROW(loaded.MLOAD_BINARY(filename), runtime_error);
+    BOOST_CHECK_THROW(mapped.MMAP_BINARY(filename), runtime_error);
+    cleanFile(filename);
+
+    // Рост за пределы max_size() даёт length_error, а не переполнение
+    BOOST_CHECK_EQUAL(growCapacity(3, 4, 100), 6);
+    BOOST_CHECK_EQUAL(growCapacity(60, 61, 100), 100);
+    BOOST_CHECK_THROW(growCapacity(100, 101, 100), length_error);
+    BOOST_CHECK_EQUAL(growCapacity(size_t(1) << 62, (size_t(1) << 62) + 1, SIZE_MAX), size_t(1) << 63);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -174,6 +174,28 @@ BOOST_AUTO_TEST_CASE(TextSerialization) {
     remove(TEXT_FILE.c_str());
 }
 
+// Файл со старой раскладкой: сохранённые индексы не совпадают с текущими
+// хэш-функциями, элементы всё равно находятся после загрузки
+BOOST_AUTO_TEST_CASE(TextLegacyLayout) {
+    {
+        ofstream oldFile(TEXT_FILE);
+        oldFile << "11 3\n10 apple 5\n9 banana 10\n8 cherry 15\n";
+    }
+
+    CuckooHash<int> loadedHash;
+    loadedHash.deserialize_text(TEXT_FILE);
+
+    BOOST_CHECK_EQUAL(loadedHash.size(), 3);
+    BOOST_REQUIRE(loadedHash.find("apple") != nullptr);
+    BOOST_CHECK_EQUAL(*loadedHash.find("apple"), 5);
+    BOOST_REQUIRE(loadedHash.find("banana") != nullptr);
+    BOOST_CHECK_EQUAL(*loadedHash.find("banana"), 10);
+    BOOST_REQUIRE(loadedHash.find("cherry") != nullptr);
+    BOOST_CHECK_EQUAL(*loadedHash.find("cherry"), 15);
+
+    remove(TEXT_FILE.c_str());
+}
+
 // Бинарная сериализация
 BOOST_AUTO_TEST_CASE(BinarySerialization) {
     {
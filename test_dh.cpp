@@ -177,6 +177,29 @@ BOOST_AUTO_TEST_CASE(TextSerializationTest) {
     remove(filename.c_str());
 }
 
+// Файл со старой раскладкой: сохранённые индексы не совпадают с текущими
+// хэш-функциями, элементы всё равно находятся после загрузки
+BOOST_AUTO_TEST_CASE(TextLegacyLayoutTest) {
+    string filename = "test_hash_legacy.txt";
+    {
+        ofstream oldFile(filename);
+        oldFile << "11 3\n10 apple 5\n9 banana 10\n8 cherry 15\n";
+    }
+
+    DoubleHash<int> dh_loaded;
+    dh_loaded.deserialize_text(filename);
+
+    BOOST_CHECK_EQUAL(dh_loaded.size(), 3);
+    BOOST_REQUIRE(dh_loaded.find("apple") != nullptr);
+    BOOST_CHECK_EQUAL(*dh_loaded.find("apple"), 5);
+    BOOST_REQUIRE(dh_loaded.find("banana") != nullptr);
+    BOOST_CHECK_EQUAL(*dh_loaded.find("banana"), 10);
+    BOOST_REQUIRE(dh_loaded.find("cherry") != nullptr);
+    BOOST_CHECK_EQUAL(*dh_loaded.find("cherry"), 15);
+
+    remove(filename.c_str());
+}
+
 // Тесты бинарной сериализации
 BOOST_AUTO_TEST_CASE(BinarySerializationTest) {
     string filename = "test_hash_dump.bin";
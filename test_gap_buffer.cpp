@@ -0,0 +1,102 @@
+#define BOOST_TEST_MODULE GapBufferTestModule
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "gap_buffer.hpp"
+
+using namespace std;
+
+// Сравнение содержимого буфера с эталонным vector
+template <typename T>
+void checkEqual(const GapBuffer<T>& gb, const vector<T>& expected) {
+    BOOST_REQUIRE_EQUAL(gb.GetSize(), expected.size());
+    for (uint32_t i = 0; i < expected.size(); ++i) {
+        BOOST_CHECK_EQUAL(gb[i], expected[i]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(GapBufferTests)
+
+// Тест вставки и удаления у курсора
+BOOST_AUTO_TEST_CASE(InsertAndDeleteAtCursor) {
+    GapBuffer<char> gb;
+    BOOST_CHECK_EQUAL(gb.GetSize(), 0);
+    for (char c : string("hello")) {
+        gb.GPUSH_BACK(c);
+    }
+    gb.GPUSH_BY_IND(0, '>');
+    gb.GPUSH_BY_IND(3, '-');
+    BOOST_CHECK_EQUAL(gb.GetGapPosition(), 4);
+    checkEqual(gb, vector<char>{'>', 'h', 'e', '-', 'l', 'l', 'o'});
+
+    gb.GDEL_BY_IND(3);
+    gb.GDEL_BY_IND(0);
+    checkEqual(gb, vector<char>{'h', 'e', 'l', 'l', 'o'});
+
+    BOOST_CHECK_THROW(gb.GPUSH_BY_IND(6, 'x'), out_of_range);
+    BOOST_CHECK_THROW(gb.GDEL_BY_IND(5), out_of_range);
+    BOOST_CHECK_THROW(gb[5], out_of_range);
+}
+
+// Случайная последовательность правок против std::vector
+BOOST_AUTO_TEST_CASE(RandomEditsMatchVector) {
+    GapBuffer<string> gb;
+    vector<string> expected;
+    mt19937 gen(7);
+    for (int step = 0; step < 3000; ++step) {
+        uint32_t size = static_cast<uint32_t>(expected.size());
+        if (size > 0 && gen() % 3 == 0) {
+            uint32_t index = gen() % size;
+            gb.GDEL_BY_IND(index);
+            expected.erase(expected.begin() + index);
+        } else {
+            uint32_t index = gen() % (size + 1);
+            gb.GPUSH_BY_IND(index, to_string(step));
+            expected.insert(expected.begin() + index, to_string(step));
+        }
+    }
+    checkEqual(gb, expected);
+
+    // Копия не зависит от оригинала
+    GapBuffer<string> copy = gb;
+    copy.GDEL_BY_IND(0);
+    BOOST_CHECK_EQUAL(copy.GetSize() + 1, gb.GetSize());
+    checkEqual(gb, expected);
+
+    copy = gb;
+    checkEqual(copy, expected);
+}
+
+// Аллокатор с маленьким max_size(): рост за предел должен дать length_error
+template <typename T>
+struct LimitedAllocator : allocator<T> {
+    template <typename U>
+    struct rebind {
+        using other = LimitedAllocator<U>;
+    };
+
+    LimitedAllocator() = default;
+
+    template <typename U>
+    LimitedAllocator(const LimitedAllocator<U>&) {}  // NOLINT
+
+    [[nodiscard]] auto max_size() const -> size_t {
+        return 6;
+    }
+};
+
+// Рост упирается в max_size() аллокатора, а не переполняет вместимость
+BOOST_AUTO_TEST_CASE(GrowthRespectsMaxSize) {
+    GapBuffer<int, LimitedAllocator<int>> gb;
+    for (int i = 0; i < 6; ++i) {
+        gb.GPUSH_BACK(i);
+    }
+    BOOST_CHECK_EQUAL(gb.GetCapacity(), 6);
+    BOOST_CHECK_THROW(gb.GPUSH_BY_IND(3, 42), length_error);
+    BOOST_REQUIRE_EQUAL(gb.GetSize(), 6);
+    BOOST_CHECK_EQUAL(gb[5], 5);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+#define BOOST_TEST_MODULE PriorityQueueTestModule
+#include <boost/test/included/unit_test.hpp>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "priority_queue.hpp"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(PriorityQueueTests)
+
+// Тест PPUSH / PTOP / PPOP: извлечение в порядке убывания для всех арностей
+template <uint32_t Arity>
+void checkSortedOrder() {
+    mt19937 rng(42);
+    uniform_int_distribution<int> dist(-1000, 1000);
+    PriorityQueue<int, less<int>, Arity> pq;
+    vector<int> expected;
+    for (int i = 0; i < 1000; i++) {
+        int value = dist(rng);
+        pq.PPUSH(value);
+        expected.push_back(value);
+        BOOST_REQUIRE_EQUAL(pq.PTOP(), *max_element(expected.begin(), expected.end()));
+    }
+    sort(expected.begin(), expected.end(), greater<int>());
+    BOOST_REQUIRE_EQUAL(pq.GetSize(), expected.size());
+    for (int value : expected) {
+        BOOST_REQUIRE_EQUAL(pq.PPOP(), value);
+    }
+    BOOST_CHECK(pq.empty());
+    BOOST_CHECK_THROW(pq.PPOP(), out_of_range);
+    BOOST_CHECK_THROW(pq.PTOP(), out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(PushPopOrder) {
+    checkSortedOrder<2>();
+    checkSortedOrder<4>();
+    checkSortedOrder<8>();
+
+    // Перемещаемые значения и компаратор greater<> (вершина — минимум)
+    PriorityQueue<string, greater<string>> words;
+    for (const char* word : {"pear", "apple", "fig", "banana"}) {
+        words.PPUSH(word);
+    }
+    BOOST_CHECK_EQUAL(words.PPOP(), "apple");
+    BOOST_CHECK_EQUAL(words.PPOP(), "banana");
+    BOOST_CHECK_EQUAL(words.PTOP(), "fig");
+}
+
+// Тест построения кучи из Array за O(n): дескриптор values[i] равен i
+BOOST_AUTO_TEST_CASE(HeapifyFromArray) {
+    Array<int> values;
+    for (int i = 0; i < 257; i++) {
+        values.MPUSH_BACK((i * 37) % 257);
+    }
+    PriorityQueue<int, greater<int>, 8> pq(values);
+    BOOST_REQUIRE_EQUAL(pq.GetSize(), 257);
+    for (size_t i = 0; i < values.GetSize(); i++) {
+        BOOST_CHECK_EQUAL(pq.PGET(i), values[i]);
+    }
+    BOOST_CHECK_EQUAL(pq.PTOP_HANDLE(), 0);  // values[0] == 0
+    for (int expected = 0; expected < 257; expected++) {
+        BOOST_REQUIRE_EQUAL(pq.PPOP(), expected);
+    }
+
+    PriorityQueue<int> empty(Array<int>{});
+    BOOST_CHECK(empty.empty());
+}
+
+// Тест дескрипторов: decrease-key, перемещение вниз, удаление и повторная выдача
+BOOST_AUTO_TEST_CASE(HandlesUpdateAndErase) {
+    PriorityQueue<int, greater<int>, 4> pq;
+    vector<PriorityQueue<int, greater<int>, 4>::Handle> handles;
+    for (int i = 0; i < 100; i++) {
+        handles.push_back(pq.PPUSH(1000 + i));
+    }
+    pq.PUPDATE(handles[73], 5);  // decrease-key: элемент поднимается на вершину
+    BOOST_CHECK_EQUAL(pq.PTOP(), 5);
+    BOOST_CHECK_EQUAL(pq.PTOP_HANDLE(), handles[73]);
+    pq.PUPDATE(handles[73], 5000);  // Обратное изменение: элемент уходит вниз
+    BOOST_CHECK_EQUAL(pq.PTOP(), 1000);
+    BOOST_CHECK_EQUAL(pq.PGET(handles[73]), 5000);
+
+    pq.PERASE(handles[0]);
+    pq.PERASE(handles[50]);
+    BOOST_CHECK(!pq.PCONTAINS(handles[0]));
+    BOOST_CHECK(pq.PCONTAINS(handles[1]));
+    BOOST_CHECK_THROW(pq.PERASE(handles[50]), out_of_range);
+    BOOST_CHECK_THROW(pq.PGET(12345), out_of_range);
+    BOOST_CHECK_EQUAL(pq.GetSize(), 98);
+
+    auto reused = pq.PPUSH(1);
+    BOOST_CHECK(reused == handles[0] || reused == handles[50]);
+    BOOST_CHECK_EQUAL(pq.PTOP_HANDLE(), reused);
+
+    // Порядок извлечения после всех изменений
+    vector<int> popped;
+    while (!pq.empty()) {
+        popped.push_back(pq.PPOP());
+    }
+    BOOST_CHECK(is_sorted(popped.begin(), popped.end()));
+    BOOST_CHECK_EQUAL(popped.front(), 1);
+    BOOST_CHECK_EQUAL(popped.back(), 5000);
+}
+
+// Случайные операции против эталонного multiset-подобного vector
+BOOST_AUTO_TEST_CASE(RandomizedAgainstReference) {
+    mt19937 rng(7);
+    PriorityQueue<int, less<int>, 2> pq;
+    vector<pair<PriorityQueue<int>::Handle, int>> live;
+    for (int step = 0; step < 20000; step++) {
+        uint32_t op = rng() % 4;
+        if (op == 0 || live.empty()) {
+            int value = static_cast<int>(rng() % 10000);
+            live.emplace_back(pq.PPUSH(value), value);
+        } else if (op == 1) {
+            size_t i = rng() % live.size();
+            int value = static_cast<int>(rng() % 10000);
+            pq.PUPDATE(live[i].first, value);
+            live[i].second = value;
+        } else if (op == 2) {
+            size_t i = rng() % live.size();
+            pq.PERASE(live[i].first);
+            live.erase(live.begin() + static_cast<ptrdiff_t>(i));
+        } else {
+            auto best = max_element(live.begin(), live.end(),
+                                    [](const auto& a, const auto& b) { return a.second < b.second; });
+            BOOST_REQUIRE_EQUAL(pq.PTOP(), best->second);
+            auto top = pq.PTOP_HANDLE();
+            BOOST_REQUIRE_EQUAL(pq.PPOP(), best->second);
+            live.erase(find_if(live.begin(), live.end(), [top](const auto& e) { return e.first == top; }));
+        }
+        BOOST_REQUIRE_EQUAL(pq.GetSize(), live.size());
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -4,7 +4,14 @@
 #include "queue.hpp"
 #include <string>
 #include <vector>
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <atomic>
 #include <cstdio> // Для remove()
+#include <fcntl.h>
+#include <unistd.h>
 
 using namespace std;
 
@@ -71,6 +78,57 @@ BOOST_AUTO_TEST_CASE(PushPopGetTest) {
     BOOST_CHECK(q.empty());
 }
 
+// Тест пакетных QPUSH_BATCH / QPOP_BATCH на "свёрнутом" кольце
+BOOST_AUTO_TEST_CASE(BatchPushPopTest) {
+    Queue<int> q(8);
+    for (int i = 0; i < 6; i++) {
+        q.QPUSH(i);
+    }
+    vector<int> out(4);
+    BOOST_CHECK_EQUAL(q.QPOP_BATCH(out), 4);
+    BOOST_CHECK((out == vector<int>{0, 1, 2, 3}));
+
+    // Голова в ячейке 4: пакет записывается в конец буфера и в его начало
+    vector<int> items = {6, 7, 8, 9, 10};
+    q.QPUSH_BATCH(items);
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(q.GetSize(), 7);
+
+    // Пакет из элементов самой очереди во время расширения
+    q.QPUSH_BATCH(span<const int>(&q.QGET(), 4));  // 4, 5, 6, 7
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 16);
+
+    vector<int> all(20);
+    BOOST_CHECK_EQUAL(q.QPOP_BATCH(all), 11);
+    all.resize(11);
+    BOOST_CHECK((all == vector<int>{4, 5, 6, 7, 8, 9, 10, 4, 5, 6, 7}));
+    BOOST_CHECK(q.empty());
+
+    // Участок полного кольца, непрерывный в памяти, но пересекающий head:
+    // ячейки 1..4 хранят 9, 10 (конец очереди) и 3, 4 (её начало)
+    Queue<int> full(8);
+    for (int i = 0; i < 8; i++) {
+        full.QPUSH(i);
+    }
+    vector<int> dropped(3);
+    full.QPOP_BATCH(dropped);
+    for (int i = 8; i < 11; i++) {
+        full.QPUSH(i);
+    }
+    full.QPUSH_BATCH(span<const int>(&full.QGET() - 2, 4));
+    BOOST_CHECK_EQUAL(full.GetSize(), 12);
+    vector<int> drained(12);
+    full.QPOP_BATCH(drained);
+    BOOST_CHECK((drained == vector<int>{3, 4, 5, 6, 7, 8, 9, 10, 9, 10, 3, 4}));
+
+    Queue<string> strings(2);
+    vector<string> words = {"x", "y", "z"};
+    strings.QPUSH_BATCH(words);
+    vector<string> got(3);
+    BOOST_CHECK_EQUAL(strings.QPOP_BATCH(got), 3);
+    BOOST_CHECK((got == words));
+}
+
 // Тест расширения массива (Resize)
 BOOST_AUTO_TEST_CASE(ResizeTest) {
     // Создаем маленькую очередь
@@ -97,8 +155,11 @@ BOOST_AUTO_TEST_CASE(ResizeTest) {
 
 // Тест кольцевого буфера 
 BOOST_AUTO_TEST_CASE(CircularBufferTest) {
-    // Емкость 3
+    // Емкость 3 округляется до степени двойки
     Queue<int> q(3);
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 4);
+    q.QPUSH(0);
+    q.QPOP();
 
     q.QPUSH(1);
     q.QPUSH(2);
@@ -173,6 +234,7 @@ BOOST_AUTO_TEST_CASE(FileIOSaveLoadTest) {
         
         // Save
         q.QSAVE(filename);
+        BOOST_CHECK_THROW(q.QSAVE("/dev/full"), runtime_error);
     } 
 
     {
@@ -227,6 +289,72 @@ BOOST_AUTO_TEST_CASE(BinaryFileIOTest) {
     remove(filename.c_str());
 }
 
+// Тест бинарного ввода-вывода "свёрнутого" кольца и потокового QPUSH_FD
+BOOST_AUTO_TEST_CASE(BulkBinaryIOTest) {
+    string filename = "queue_test_bulk.dat";
+    Queue<int> q(8);
+    for (int i = 0; i < 6; i++) {
+        q.QPUSH(i);
+    }
+    for (int i = 0; i < 4; i++) {
+        q.QPOP();
+    }
+    for (int i = 6; i < 11; i++) {
+        q.QPUSH(i);  // Хвост переходит через конец буфера: 4..10
+    }
+    q.QSAVE_BINARY(filename);
+
+    Queue<int> loaded;
+    loaded.QPUSH(-1);  // Прежнее содержимое заменяется
+    loaded.QLOAD_BINARY(filename);
+    BOOST_CHECK_EQUAL(loaded.GetSize(), 7);
+    BOOST_CHECK_EQUAL(loaded.GetCapacity(), 8);
+    loaded.QPUSH(11);
+    for (int i = 4; i < 12; i++) {
+        BOOST_CHECK_EQUAL(loaded.QPOP(), i);
+    }
+
+    // Из файла: заголовок пропускается, элементы добавляются к имеющимся
+    int fd = open(filename.c_str(), O_RDONLY);
+    BOOST_REQUIRE(fd >= 0);
+    lseek(fd, static_cast<off_t>(binary_format::headerBytes), SEEK_SET);
+    Queue<int> streamed;
+    streamed.QPUSH(3);
+    BOOST_CHECK_EQUAL(streamed.QPUSH_FD(fd, 5), 5);
+    BOOST_CHECK_EQUAL(streamed.QPUSH_FD(fd), 2);
+    close(fd);
+    BOOST_CHECK_EQUAL(streamed.GetSize(), 8);
+    for (int i = 3; i < 11; i++) {
+        BOOST_CHECK_EQUAL(streamed.QPOP(), i);
+    }
+    remove(filename.c_str());
+
+    // Из канала порциями, которые режут элементы пополам
+    int fds[2];
+    BOOST_REQUIRE(pipe(fds) == 0);
+    vector<int64_t> values(1000);
+    iota(values.begin(), values.end(), 0);
+    const char* bytes = reinterpret_cast<const char*>(values.data());
+    size_t total = values.size() * sizeof(int64_t);
+    for (size_t offset = 0; offset < total; offset += 13) {
+        BOOST_REQUIRE(write(fds[1], bytes + offset, min<size_t>(13, total - offset)) > 0);
+    }
+    close(fds[1]);
+    Queue<int64_t> piped;
+    BOOST_CHECK_EQUAL(piped.QPUSH_FD(fds[0]), values.size());
+    close(fds[0]);
+    vector<int64_t> out(values.size());
+    piped.QPOP_BATCH(out);
+    BOOST_CHECK((out == values));
+
+    // Поток, оборванный посреди элемента
+    BOOST_REQUIRE(pipe(fds) == 0);
+    BOOST_REQUIRE(write(fds[1], bytes, 12) == 12);
+    close(fds[1]);
+    BOOST_CHECK_THROW(piped.QPUSH_FD(fds[0]), runtime_error);
+    close(fds[0]);
+}
+
 // Тест функции PRINT 
 BOOST_AUTO_TEST_CASE(PrintTest) {
     CoutRedirect capture;
@@ -254,4 +382,361 @@ BOOST_AUTO_TEST_CASE(StringQueueTest) {
     BOOST_CHECK_EQUAL(q.QPOP(), "String");
 }
 
+// Тест QEMPLACE, доступа к голове по ссылке и извлечения перемещением
+BOOST_AUTO_TEST_CASE(EmplaceAndMovePopTest) {
+    Queue<string> q(2);
+    BOOST_CHECK_EQUAL(q.QEMPLACE(3, 'x'), "xxx");
+    q.QGET() += "y";
+    BOOST_CHECK_EQUAL(q.QGET(), "xxxy");
+
+    // Голова сдвинута, кольцо "свёрнуто"; аргумент ссылается на голову
+    // очереди, которая при этом расширяется
+    string longValue(40, 'a');
+    q.QPUSH(longValue);
+    q.QPUSH(q.QPOP());
+    for (int i = 0; i < 5; i++) {
+        q.QPUSH(q.QGET());
+    }
+    BOOST_CHECK_EQUAL(q.GetSize(), 7);
+    BOOST_CHECK_EQUAL(q.QPOP(), longValue);
+    const Queue<string>& view = q;
+    BOOST_CHECK_EQUAL(view.QGET(), "xxxy");
+    BOOST_CHECK_EQUAL(q.QPOP(), "xxxy");
+    for (int i = 0; i < 5; i++) {
+        BOOST_CHECK_EQUAL(q.QPOP(), longValue);
+    }
+    BOOST_CHECK_THROW(view.QGET(), out_of_range);
+}
+
+// Тест политики уменьшения буфера: кольцо "распрямляется" при сжатии
+BOOST_AUTO_TEST_CASE(ShrinkPolicyTest) {
+    Queue<string> q;
+    q.SetShrinkPolicy(ShrinkPolicy::Quarter());
+    for (int i = 0; i < 1000; i++) {
+        q.QPUSH(to_string(i));
+    }
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 1024);
+    for (int i = 0; i < 900; i++) {
+        q.QPOP();
+    }
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 256);
+    for (int i = 1000; i < 1100; i++) {
+        q.QPUSH(to_string(i));  // Хвост обходит конец буфера
+    }
+    BOOST_CHECK_EQUAL(q.QGET(), "900");
+    for (int i = 900; i < 1000; i++) {
+        BOOST_CHECK_EQUAL(q.QPOP(), to_string(i));
+    }
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 256);
+
+    q.shrink_to_fit();
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 128);  // Степень двойки, вмещающая 100
+    for (int i = 1000; i < 1100; i++) {
+        BOOST_CHECK_EQUAL(q.QPOP(), to_string(i));
+    }
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 16);  // 128 -> 64 -> 32 -> 16 (minCapacity)
+
+    // Частично заполненная очередь: divisor 1 и 2 отвергаются
+    Queue<int> part;
+    for (int i = 0; i < 10; i++) {
+        part.QPUSH(i);
+    }
+    BOOST_CHECK_THROW(part.SetShrinkPolicy(ShrinkPolicy{1, 4}), invalid_argument);
+    BOOST_CHECK_THROW(part.SetShrinkPolicy(ShrinkPolicy{2, 4}), invalid_argument);
+    part.SetShrinkPolicy(ShrinkPolicy{3, 4});
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 16);
+    while (part.GetSize() > 4) {
+        part.QPOP();
+    }
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(part.QPOP(), 6);
+
+    Queue<int> assigned;
+    assigned = part;
+    BOOST_CHECK_EQUAL(assigned.GetShrinkPolicy().divisor, 3);
+}
+
+// Тест пользовательских аллокаторов
+BOOST_AUTO_TEST_CASE(CustomAllocatorTest) {
+    Arena arena;
+    Queue<string, ArenaAllocator<string>> q{ArenaAllocator<string>(arena)};
+    for (int i = 0; i < 100; i++) {
+        q.QPUSH(to_string(i));
+        if (i % 3 == 0) {
+            q.QPOP();  // Сдвигаем голову, чтобы буфер был "свёрнут"
+        }
+    }
+    Queue<string, ArenaAllocator<string>> copy = q;
+    BOOST_CHECK_EQUAL(copy.GetSize(), q.GetSize());
+    while (!q.empty()) {
+        BOOST_CHECK_EQUAL(copy.QPOP(), q.QPOP());
+    }
+
+    Queue<int, HugePageAllocator<int>> big;
+    for (int i = 0; i < (1 << 20); i++) {
+        big.QPUSH(i);
+    }
+    BOOST_CHECK_EQUAL(big.QPOP(), 0);
+    BOOST_CHECK_EQUAL(big.GetSize(), (1 << 20) - 1);
+}
+
+// Тест SPSC-очереди: заполнение, пакеты через конец буфера и передача
+// между двумя потоками с сохранением порядка
+BOOST_AUTO_TEST_CASE(SpscQueueTest) {
+    SpscQueue<string> q(3);
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 4);
+    BOOST_CHECK(q.QTRY_PUSH("a"));
+    BOOST_CHECK(q.QTRY_EMPLACE(2, 'b'));
+    string value;
+    BOOST_CHECK(q.QTRY_POP(value));
+    BOOST_CHECK_EQUAL(value, "a");
+
+    vector<string> items = {"c", "d", "e", "f"};
+    BOOST_CHECK_EQUAL(q.QPUSH_BATCH(items), 3);  // Поместились только три
+    BOOST_CHECK(!q.QTRY_PUSH("g"));
+    vector<string> out(8);
+    BOOST_CHECK_EQUAL(q.QPOP_BATCH(out), 4);
+    BOOST_CHECK((vector<string>(out.begin(), out.begin() + 4) == vector<string>{"bb", "c", "d", "e"}));
+    BOOST_CHECK(!q.QTRY_POP(value));
+    BOOST_CHECK(q.empty());
+    BOOST_CHECK(q.QTRY_PUSH("left"));  // Остаток удаляется деструктором
+
+    const int count = 100000;
+    SpscQueue<int> ring(64);
+    thread producer([&ring]() {
+        vector<int> batch(7);
+        int next = 0;
+        while (next < count) {
+            if (next % 2 == 0) {
+                size_t n = min<size_t>(batch.size(), count - next);
+                for (size_t i = 0; i < n; i++) {
+                    batch[i] = next + static_cast<int>(i);
+                }
+                next += static_cast<int>(ring.QPUSH_BATCH(span<const int>(batch.data(), n)));
+            } else if (ring.QTRY_PUSH(next)) {
+                next++;
+            }
+            if (next < count) {
+                this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    bool ordered = true;
+    vector<int> received(5);
+    while (expected < count) {
+        size_t n = ring.QPOP_BATCH(received);
+        for (size_t i = 0; i < n; i++) {
+            ordered = ordered && received[i] == expected++;
+        }
+        int single = 0;
+        if (ring.QTRY_POP(single)) {
+            ordered = ordered && single == expected++;
+        }
+        this_thread::yield();
+    }
+    producer.join();
+    BOOST_CHECK(ordered);
+    BOOST_CHECK_EQUAL(expected, count);
+}
+
+// Тест MPMC-очереди: каждый элемент получен ровно один раз, а элементы
+// одного производителя приходят к потребителю в порядке добавления
+BOOST_AUTO_TEST_CASE(MpmcQueueTest) {
+    MpmcQueue<string> q(1);
+    BOOST_CHECK_EQUAL(q.GetCapacity(), 2);
+    BOOST_CHECK(q.QTRY_PUSH("a"));
+    BOOST_CHECK(q.QTRY_EMPLACE(2, 'b'));
+    BOOST_CHECK(!q.QTRY_PUSH("c"));
+    BOOST_CHECK_EQUAL(q.QPOP(), "a");
+    string value;
+    BOOST_CHECK(q.QTRY_POP(value));
+    BOOST_CHECK_EQUAL(value, "bb");
+    BOOST_CHECK(!q.QTRY_POP(value));
+    q.QPUSH("left");  // Остаток удаляется деструктором
+
+    const int producers = 3;
+    const int consumers = 3;
+    const int perProducer = 20000;
+    MpmcQueue<int> ring(16);
+    vector<vector<int>> received(consumers);
+    vector<thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&ring, p]() {
+            for (int i = 0; i < perProducer; i++) {
+                ring.QPUSH(p * perProducer + i);
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&ring, &received, c]() {
+            for (int i = 0; i < producers * perProducer / consumers; i++) {
+                received[c].push_back(ring.QPOP());
+            }
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+    BOOST_CHECK(ring.empty());
+
+    vector<int> all;
+    bool ordered = true;
+    for (const vector<int>& part : received) {
+        vector<int> last(producers, -1);
+        for (int item : part) {
+            ordered = ordered && item > last[item / perProducer];
+            last[item / perProducer] = item;
+        }
+        all.insert(all.end(), part.begin(), part.end());
+    }
+    sort(all.begin(), all.end());
+    vector<int> expected(producers * perProducer);
+    iota(expected.begin(), expected.end(), 0);
+    BOOST_CHECK(ordered);
+    BOOST_CHECK((all == expected));
+}
+
+// Тест очереди с кражей работы: владелец работает с нижним концом как со
+// стеком, воры забирают верхний; каждый элемент достаётся ровно одному потоку
+BOOST_AUTO_TEST_CASE(WorkStealingDequeTest) {
+    WorkStealingDeque<int> deque(2);
+    BOOST_CHECK_EQUAL(deque.GetCapacity(), 2);
+    int value = 0;
+    BOOST_CHECK(!deque.QPOP(value));
+    BOOST_CHECK(!deque.QSTEAL(value));
+    for (int i = 0; i < 5; i++) {
+        deque.QPUSH(i);  // Кольцо растёт 2 -> 4 -> 8
+    }
+    BOOST_CHECK_EQUAL(deque.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(deque.GetSize(), 5);
+    BOOST_CHECK(deque.QPOP(value));
+    BOOST_CHECK_EQUAL(value, 4);
+    BOOST_CHECK(deque.QSTEAL(value));
+    BOOST_CHECK_EQUAL(value, 0);
+    BOOST_CHECK(deque.QPOP(value));
+    BOOST_CHECK_EQUAL(value, 3);
+    BOOST_CHECK_EQUAL(deque.GetSize(), 2);
+
+    // Владелец добавляет и извлекает, три вора крадут одновременно
+    const int total = 200000;
+    const int thieves = 3;
+    WorkStealingDeque<int> shared(4);
+    atomic<bool> done{false};
+    vector<vector<int>> stolen(thieves);
+    vector<thread> threads;
+    for (int t = 0; t < thieves; t++) {
+        threads.emplace_back([&shared, &done, &stolen, t]() {
+            int item = 0;
+            while (!done.load(memory_order_acquire) || !shared.empty()) {
+                if (shared.QSTEAL(item)) {
+                    stolen[t].push_back(item);
+                }
+            }
+        });
+    }
+    vector<int> owned;
+    for (int i = 0; i < total; i++) {
+        shared.QPUSH(i);
+        if (i % 3 == 0 && shared.QPOP(value)) {
+            owned.push_back(value);
+        }
+    }
+    while (shared.QPOP(value)) {
+        owned.push_back(value);
+    }
+    done.store(true, memory_order_release);
+    for (thread& worker : threads) {
+        worker.join();
+    }
+
+    vector<int> all = owned;
+    for (const vector<int>& part : stolen) {
+        all.insert(all.end(), part.begin(), part.end());
+    }
+    sort(all.begin(), all.end());
+    vector<int> expected(total);
+    iota(expected.begin(), expected.end(), 0);
+    BOOST_CHECK((all == expected));
+}
+
+// Тест блокирующей очереди: таймауты, пробуждение ожидающих,
+// закрытие с извлечением остатка
+BOOST_AUTO_TEST_CASE(BlockingQueueTest) {
+    using namespace std::chrono_literals;
+    BlockingQueue<string> q(2);
+    BOOST_CHECK(q.QTRY_PUSH("a"));
+    BOOST_CHECK(q.QPUSH("b") == QueueStatus::Success);
+    BOOST_CHECK(q.QPUSH_FOR("c", 20ms) == QueueStatus::Timeout);
+
+    // Производитель ждёт места, потребитель его освобождает
+    QueueStatus pushStatus = QueueStatus::Timeout;
+    thread producer([&q, &pushStatus]() {
+        pushStatus = q.QPUSH("c");
+    });
+    string value;
+    this_thread::sleep_for(10ms);
+    BOOST_CHECK(q.QPOP(value) == QueueStatus::Success);
+    BOOST_CHECK_EQUAL(value, "a");
+    producer.join();
+    BOOST_CHECK(pushStatus == QueueStatus::Success);
+
+    vector<string> out(4);
+    BOOST_CHECK_EQUAL(q.QPOP_BATCH(out), 2);
+    BOOST_CHECK_EQUAL(out[1], "c");
+    BOOST_CHECK(q.QPOP_FOR(value, 20ms) == QueueStatus::Timeout);
+
+    // Ожидающий потребитель просыпается при закрытии
+    QueueStatus popStatus = QueueStatus::Success;
+    thread consumer([&q, &popStatus]() {
+        string item;
+        popStatus = q.QPOP(item);
+    });
+    this_thread::sleep_for(10ms);
+    q.close();
+    consumer.join();
+    BOOST_CHECK(popStatus == QueueStatus::Closed);
+    BOOST_CHECK(q.QPUSH("d") == QueueStatus::Closed);
+    BOOST_CHECK(!q.QTRY_PUSH("d"));
+
+    // После закрытия остаток извлекается, затем — Closed
+    BlockingQueue<int> ints(8);
+    vector<int> batch = {1, 2, 3};
+    BOOST_CHECK_EQUAL(ints.QPUSH_BATCH(batch), 3);
+    ints.close();
+    BOOST_CHECK(ints.is_closed());
+    int number = 0;
+    BOOST_CHECK(ints.QPOP(number) == QueueStatus::Success);
+    BOOST_CHECK_EQUAL(number, 1);
+    BOOST_CHECK_EQUAL(ints.QPOP_BATCH(span<int>(batch.data(), 3)), 2);
+    BOOST_CHECK(ints.QPOP_FOR(number, 1s) == QueueStatus::Closed);
+
+    // Несколько производителей и потребителей на маленькой очереди
+    BlockingQueue<int> pipe(4);
+    const int perProducer = 5000;
+    atomic<long long> sum{0};
+    vector<thread> threads;
+    for (int p = 0; p < 2; p++) {
+        threads.emplace_back([&pipe]() {
+            for (int i = 1; i <= perProducer; i++) {
+                pipe.QPUSH(i);
+            }
+        });
+    }
+    for (int c = 0; c < 2; c++) {
+        threads.emplace_back([&pipe, &sum]() {
+            int item = 0;
+            while (pipe.QPOP(item) == QueueStatus::Success) {
+                sum += item;
+            }
+        });
+    }
+    threads[0].join();
+    threads[1].join();
+    pipe.close();
+    threads[2].join();
+    threads[3].join();
+    BOOST_CHECK_EQUAL(sum.load(), 2LL * perProducer * (perProducer + 1) / 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
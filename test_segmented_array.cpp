@@ -0,0 +1,95 @@
+#define BOOST_TEST_MODULE SegmentedArrayTestModule
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <vector>
+
+#include "segmented_array.hpp"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(SegmentedArrayTests)
+
+// Тест добавления элементов и доступа по индексу на границах блоков
+BOOST_AUTO_TEST_CASE(PushBackAndAccess) {
+    SegmentedArray<int> arr;
+    BOOST_CHECK_EQUAL(arr.GetSize(), 0);
+    BOOST_CHECK_EQUAL(arr.GetCapacity(), 0);
+
+    for (int i = 0; i < 10000; ++i) {
+        arr.MPUSH_BACK(i);
+    }
+    BOOST_CHECK_EQUAL(arr.GetSize(), 10000);
+    BOOST_CHECK(arr.GetCapacity() >= 10000);
+    for (int i = 0; i < 10000; ++i) {
+        BOOST_CHECK_EQUAL(arr[i], i);
+    }
+
+    // Первый блок — 16 элементов, второй — 32: индексы 15/16 и 47/48 на стыках
+    BOOST_CHECK_EQUAL(arr.MGET_UNCHECKED(15), 15);
+    BOOST_CHECK_EQUAL(arr.MGET_UNCHECKED(16), 16);
+    BOOST_CHECK_EQUAL(arr.MGET_UNCHECKED(47), 47);
+    BOOST_CHECK_EQUAL(arr.MGET_UNCHECKED(48), 48);
+
+    arr.MSWAP_BY_IND(5, -5);
+    BOOST_CHECK_EQUAL(arr[5], -5);
+    BOOST_CHECK_THROW(arr[10000], out_of_range);
+    BOOST_CHECK_THROW(arr.MSWAP_BY_IND(10000, 1), out_of_range);
+}
+
+// Тест стабильности адресов при росте
+BOOST_AUTO_TEST_CASE(StableAddresses) {
+    SegmentedArray<string> arr;
+    arr.MPUSH_BACK("first");
+    string* first = &arr[0];
+    for (int i = 0; i < 5000; ++i) {
+        arr.MPUSH_BACK(to_string(i));
+    }
+    BOOST_CHECK_EQUAL(first, &arr[0]);
+    BOOST_CHECK_EQUAL(*first, "first");
+    BOOST_CHECK_EQUAL(arr[5000], "4999");
+}
+
+// Тест извлечения, обхода и очистки
+BOOST_AUTO_TEST_CASE(PopForEachAndClear) {
+    SegmentedArray<int> arr;
+    BOOST_CHECK_THROW(arr.MPOP_BACK(), out_of_range);
+    for (int i = 1; i <= 100; ++i) {
+        arr.MPUSH_BACK(i);
+    }
+    BOOST_CHECK_EQUAL(arr.MPOP_BACK(), 100);
+    BOOST_CHECK_EQUAL(arr.GetSize(), 99);
+
+    int sum = 0;
+    arr.MFOR_EACH([&sum](int value) { sum += value; });
+    BOOST_CHECK_EQUAL(sum, 99 * 100 / 2);
+
+    arr.clear();
+    BOOST_CHECK_EQUAL(arr.GetSize(), 0);
+    BOOST_CHECK_EQUAL(arr.GetChunkCount(), 0);
+    arr.MPUSH_BACK(7);
+    BOOST_CHECK_EQUAL(arr[0], 7);
+}
+
+// Тест копирования и перемещения
+BOOST_AUTO_TEST_CASE(CopyAndMove) {
+    SegmentedArray<string> arr;
+    for (int i = 0; i < 300; ++i) {
+        arr.MPUSH_BACK(to_string(i));
+    }
+
+    SegmentedArray<string> copy = arr;
+    BOOST_CHECK_EQUAL(copy.GetSize(), 300);
+    copy.MSWAP_BY_IND(0, "changed");
+    BOOST_CHECK_EQUAL(arr[0], "0");
+
+    SegmentedArray<string> moved = std::move(copy);
+    BOOST_CHECK_EQUAL(moved.GetSize(), 300);
+    BOOST_CHECK_EQUAL(moved[0], "changed");
+    BOOST_CHECK_EQUAL(copy.GetSize(), 0);
+
+    moved = arr;
+    BOOST_CHECK_EQUAL(moved[0], "0");
+    BOOST_CHECK_EQUAL(moved[299], "299");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,8 @@
 #include <cstdio>   
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 // Вспомогательная структура для перехвата cout
 struct CoutRedirect {
@@ -114,6 +116,8 @@ BOOST_AUTO_TEST_CASE(FileIO_Text) {
         sOut.SPUSH(42);
         sOut.SPUSH(123);
         sOut.SSAVE(filename);
+        // Ошибка записи (нет места на устройстве) не должна теряться
+        BOOST_CHECK_THROW(sOut.SSAVE("/dev/full"), runtime_error);
     } // sOut уничтожается
 
     Stack<int> sIn;
@@ -151,6 +155,18 @@ BOOST_AUTO_TEST_CASE(FileIO_Binary) {
     // Тест на загрузку несуществующего файла
     BOOST_CHECK_THROW(sIn.SLOAD_BINARY("non_existent.bin"), runtime_error);
 
+    // Файл старого формата с 32-битным размером
+    {
+        ofstream file(filename, ios::binary);
+        uint32_t legacySize = 1;
+        double value = 1.5;
+        file.write(reinterpret_cast<const char*>(&legacySize), sizeof(legacySize));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+    sIn.SLOAD_BINARY(filename);
+    BOOST_CHECK_EQUAL(sIn.GetSize(), 1);
+    BOOST_CHECK_CLOSE(sIn.SPOP(), 1.5, 0.001);
+
     remove(filename.c_str());
 }
 
@@ -180,4 +196,184 @@ BOOST_AUTO_TEST_CASE(StringStack) {
     BOOST_CHECK_EQUAL(s.SPOP(), "Hello");
 }
 
+// Тестирование SEMPLACE, доступа к вершине и извлечения перемещением
+BOOST_AUTO_TEST_CASE(EmplaceTopAndMovePop) {
+    Stack<string> s(1);
+    BOOST_CHECK_THROW(s.STOP(), out_of_range);
+    BOOST_CHECK_EQUAL(s.SEMPLACE(3, 'x'), "xxx");
+    s.STOP() += "y";
+    BOOST_CHECK_EQUAL(s.STOP(), "xxxy");
+
+    // Аргумент ссылается на вершину стека, который при этом расширяется
+    string longValue(40, 'a');
+    s.SPUSH(longValue);
+    for (int i = 0; i < 5; i++) {
+        s.SPUSH(s.STOP());
+    }
+    BOOST_CHECK_EQUAL(s.GetSize(), 7);
+    BOOST_CHECK_EQUAL(s.STOP(), longValue);
+
+    string moved(40, 'b');
+    s.SPUSH(std::move(moved));
+    const Stack<string>& view = s;
+    BOOST_CHECK_EQUAL(view.STOP(), string(40, 'b'));
+    BOOST_CHECK_EQUAL(s.SPOP(), string(40, 'b'));
+    while (s.GetSize() > 1) {
+        BOOST_CHECK_EQUAL(s.SPOP(), longValue);
+    }
+    BOOST_CHECK_EQUAL(s.SPOP(), "xxxy");
+}
+
+// Тестирование пакетных SPUSH_BATCH / SPOP_BATCH
+BOOST_AUTO_TEST_CASE(BatchPushPop) {
+    Stack<string> s(2);
+    vector<string> items = {"a", "b", "c", "d", "e"};
+    s.SPUSH_BATCH(items);  // Одно расширение до вместимости 8
+    BOOST_CHECK_EQUAL(s.GetSize(), 5);
+    BOOST_CHECK_EQUAL(s.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(s.STOP(), "e");
+
+    // Пакет из элементов самого стека во время расширения
+    s.SPUSH_BATCH(span<const string>(&s.STOP() - 4, 5));
+    BOOST_CHECK_EQUAL(s.GetSize(), 10);
+
+    vector<string> out(4);
+    BOOST_CHECK_EQUAL(s.SPOP_BATCH(out), 4);
+    BOOST_CHECK((out == vector<string>{"e", "d", "c", "b"}));
+    BOOST_CHECK_EQUAL(s.SPOP(), "a");
+
+    vector<string> rest(10);
+    BOOST_CHECK_EQUAL(s.SPOP_BATCH(rest), 5);
+    BOOST_CHECK_EQUAL(rest[0], "e");
+    BOOST_CHECK_EQUAL(rest[4], "a");
+    BOOST_CHECK_EQUAL(s.GetSize(), 0);
+    BOOST_CHECK_EQUAL(s.SPOP_BATCH(rest), 0);
+}
+
+// Тестирование встроенного буфера малой вместимости
+BOOST_AUTO_TEST_CASE(InlineStorage) {
+    SmallStack<string, 2> s;
+    s.SPUSH("a");
+    s.SPUSH("b");
+    s.SPUSH("c");  // Переполнение встроенного буфера
+    SmallStack<string, 2> copy = s;
+    BOOST_CHECK_EQUAL(copy.GetSize(), 3);
+    BOOST_CHECK_EQUAL(s.SPOP(), "c");
+    BOOST_CHECK_EQUAL(s.SPOP(), "b");
+
+    SmallStack<int, 8> small(4);
+    for (int i = 0; i < 8; ++i) {
+        small.SPUSH(i);
+    }
+    SmallStack<int, 8> assigned;
+    assigned = small;
+    BOOST_CHECK_EQUAL(assigned.SPOP(), 7);
+}
+
+// Тестирование политики уменьшения буфера
+BOOST_AUTO_TEST_CASE(ShrinkPolicyTest) {
+    Stack<int> s;
+    s.SetShrinkPolicy(ShrinkPolicy::Quarter());
+    for (int i = 0; i < 1024; i++) {
+        s.SPUSH(i);
+    }
+    BOOST_CHECK_EQUAL(s.GetCapacity(), 1024);
+    while (s.GetSize() > 100) {
+        s.SPOP();
+    }
+    BOOST_CHECK_EQUAL(s.GetCapacity(), 256);
+    BOOST_CHECK_EQUAL(s.SPOP(), 99);
+
+    s.shrink_to_fit();
+    BOOST_CHECK_EQUAL(s.GetCapacity(), 99);
+    s.SPUSH(-1);
+    BOOST_CHECK_EQUAL(s.SPOP(), -1);
+    BOOST_CHECK_EQUAL(s.SPOP(), 98);
+
+    // Частично заполненный стек: divisor 1 и 2 отвергаются
+    Stack<int> part;
+    for (int i = 0; i < 10; i++) {
+        part.SPUSH(i);
+    }
+    BOOST_CHECK_THROW(part.SetShrinkPolicy(ShrinkPolicy{1, 4}), invalid_argument);
+    BOOST_CHECK_THROW(part.SetShrinkPolicy(ShrinkPolicy{2, 4}), invalid_argument);
+    part.SetShrinkPolicy(ShrinkPolicy{3, 4});
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 16);
+    while (part.GetSize() > 4) {
+        part.SPOP();
+    }
+    BOOST_CHECK_EQUAL(part.GetCapacity(), 8);
+    BOOST_CHECK_EQUAL(part.SPOP(), 3);
+
+    Stack<int> assigned;
+    assigned = part;
+    BOOST_CHECK_EQUAL(assigned.GetShrinkPolicy().divisor, 3);
+}
+
+// Тестирование пользовательских аллокаторов
+BOOST_AUTO_TEST_CASE(CustomAllocators) {
+    Arena arena;
+    Stack<string, ArenaAllocator<string>> s{ArenaAllocator<string>(arena)};
+    for (int i = 0; i < 100; i++) {
+        s.SPUSH(to_string(i));
+    }
+    BOOST_CHECK_EQUAL(s.GetSize(), 100);
+    BOOST_CHECK_EQUAL(s.SPOP(), "99");
+
+    Stack<int, HugePageAllocator<int>> big;
+    for (int i = 0; i < (1 << 20); i++) {
+        big.SPUSH(i);
+    }
+    BOOST_CHECK_EQUAL(big.SPOP(), (1 << 20) - 1);
+}
+
+// Несколько потоков одновременно добавляют и извлекают значения:
+// каждое добавленное значение должно быть извлечено ровно один раз
+template <typename StackType>
+void checkConcurrentStack() {
+    StackType s;
+    BOOST_CHECK(s.empty());
+    BOOST_CHECK_THROW(s.SPOP(), out_of_range);
+    s.SPUSH("a");
+    s.SPUSH("b");
+    BOOST_CHECK_EQUAL(s.SPOP(), "b");
+    BOOST_CHECK_EQUAL(s.SPOP(), "a");
+
+    const int threadCount = 4;
+    const int perThread = 20000;
+    vector<vector<int>> popped(threadCount);
+    vector<thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&s, &popped, t]() {
+            string value;
+            for (int i = 0; i < perThread; i++) {
+                s.SPUSH(to_string(t * perThread + i));
+                if (i % 2 == 1 && s.STRY_POP(value)) {
+                    popped[t].push_back(stoi(value));
+                }
+            }
+            while (s.STRY_POP(value)) {
+                popped[t].push_back(stoi(value));
+            }
+        });
+    }
+    for (thread& worker : threads) {
+        worker.join();
+    }
+
+    vector<int> seen(threadCount * perThread, 0);
+    for (const vector<int>& values : popped) {
+        for (int value : values) {
+            seen[value]++;
+        }
+    }
+    BOOST_CHECK(all_of(seen.begin(), seen.end(), [](int count) { return count == 1; }));
+    BOOST_CHECK(s.empty());
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentStackTest) {
+    checkConcurrentStack<ConcurrentStack<string>>();
+    checkConcurrentStack<ConcurrentStack<string, true>>();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -0,0 +1,144 @@
+#define BOOST_TEST_MODULE ThreadPoolTestModule
+#include <boost/test/included/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "thread_pool.hpp"
+
+using namespace std;
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTests)
+
+// Тест parallel_for: каждый индекс обрабатывается ровно один раз
+BOOST_AUTO_TEST_CASE(ParallelForCoversRange) {
+    ThreadPool pool(4);
+    BOOST_CHECK_EQUAL(pool.GetThreadCount(), 4);
+
+    const size_t count = 100000;
+    vector<atomic<uint32_t>> hits(count);
+    pool.parallel_for(0, count, [&hits](size_t i) {
+        hits[i].fetch_add(1, memory_order_relaxed);
+    });
+    size_t once = 0;
+    for (const atomic<uint32_t>& hit : hits) {
+        once += hit.load() == 1 ? 1 : 0;
+    }
+    BOOST_CHECK_EQUAL(once, count);
+
+    // Явный grain, пустой диапазон и диапазон не с нуля
+    vector<int> values(1000, 0);
+    pool.parallel_for(10, 1000, [&values](size_t i) { values[i] = static_cast<int>(i); }, 7);
+    BOOST_CHECK_EQUAL(accumulate(values.begin(), values.end(), 0), (999 * 1000 / 2) - 45);
+    pool.parallel_for(5, 5, [](size_t) { throw logic_error("empty range"); });
+}
+
+auto fib(ThreadPool& pool, int n) -> int64_t {
+    if (n < 12) {
+        return n < 2 ? n : fib(pool, n - 1) + fib(pool, n - 2);
+    }
+    int64_t a = 0;
+    int64_t b = 0;
+    pool.parallel_invoke([&]() { a = fib(pool, n - 1); }, [&]() { b = fib(pool, n - 2); });
+    return a + b;
+}
+
+// Тест вложенного fork/join: задачи ждут подзадач внутри рабочих потоков
+BOOST_AUTO_TEST_CASE(ForkJoinNested) {
+    ThreadPool pool(3);
+    BOOST_CHECK_EQUAL(fib(pool, 25), 75025);
+
+    // Задачи порождают задачи той же группы
+    TaskGroup group(pool);
+    atomic<int> leaves{0};
+    for (int i = 0; i < 8; i++) {
+        group.spawn([&group, &leaves]() {
+            for (int j = 0; j < 8; j++) {
+                group.spawn([&leaves]() { leaves.fetch_add(1, memory_order_relaxed); });
+            }
+        });
+    }
+    group.wait();
+    BOOST_CHECK_EQUAL(leaves.load(), 64);
+}
+
+// Тест исключений: первое исключение задачи пробрасывается из wait,
+// остальные задачи группы всё равно завершаются
+BOOST_AUTO_TEST_CASE(ExceptionPropagation) {
+    ThreadPool pool(2);
+    atomic<int> finished{0};
+    TaskGroup group(pool);
+    for (int i = 0; i < 100; i++) {
+        group.spawn([&finished, i]() {
+            if (i == 42) {
+                throw runtime_error("task failed");
+            }
+            finished.fetch_add(1, memory_order_relaxed);
+        });
+    }
+    BOOST_CHECK_THROW(group.wait(), runtime_error);
+    BOOST_CHECK_EQUAL(finished.load(), 99);
+    group.wait();  // Ошибка уже передана вызывающему
+
+    BOOST_CHECK_THROW(pool.parallel_for(0, 1000, [](size_t i) {
+        if (i == 999) {
+            throw out_of_range("last index");
+        }
+    }), out_of_range);
+
+    // Бросают обе ветви parallel_invoke: g успевает завершиться до f,
+    // поэтому первым записано её исключение; f всё равно дожидается g
+    atomic<bool> gFinished{false};
+    BOOST_CHECK_THROW(pool.parallel_invoke(
+        [&gFinished]() {
+            while (!gFinished.load(memory_order_acquire)) {
+                this_thread::yield();
+            }
+            throw logic_error("f failed");
+        },
+        [&gFinished]() {
+            gFinished.store(true, memory_order_release);
+            throw runtime_error("g failed");
+        }), runtime_error);
+
+    // Бросает только f: исключение пробрасывается после завершения g
+    atomic<int> gRuns{0};
+    BOOST_CHECK_THROW(pool.parallel_invoke(
+        []() { throw logic_error("f failed"); },
+        [&gRuns]() {
+            this_thread::sleep_for(chrono::milliseconds(5));
+            gRuns.fetch_add(1, memory_order_relaxed);
+        }), logic_error);
+    BOOST_CHECK_EQUAL(gRuns.load(), 1);
+}
+
+// Тест групп из нескольких посторонних потоков одновременно
+BOOST_AUTO_TEST_CASE(ExternalThreads) {
+    ThreadPool pool(2);
+    const int clients = 4;
+    vector<int64_t> sums(clients, 0);
+    vector<thread> threads;
+    for (int c = 0; c < clients; c++) {
+        threads.emplace_back([&pool, &sums, c]() {
+            vector<int64_t> parts(64, 0);
+            pool.parallel_for(0, parts.size(), [&parts, c](size_t i) {
+                for (int64_t k = 0; k < 1000; k++) {
+                    parts[i] += static_cast<int64_t>(i) * 1000 + k + c;
+                }
+            }, 1);
+            sums[c] = accumulate(parts.begin(), parts.end(), int64_t{0});
+        });
+    }
+    for (thread& client : threads) {
+        client.join();
+    }
+    for (int c = 0; c < clients; c++) {
+        BOOST_CHECK_EQUAL(sums[c], 64000LL * 63999 / 2 + 64000LL * c);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,266 @@
+#ifndef TEXT_CODEC_HPP
+#define TEXT_CODEC_HPP
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Буферизованный текстовый ввод-вывод для MSAVE/MLOAD и аналогичных методов
+// контейнеров. Числа форматируются и разбираются через std::to_chars/from_chars,
+// файл читается и пишется блоками по blockSize байт. Формат файлов прежний:
+// значения разделены пробельными символами.
+namespace text_codec {
+
+inline constexpr size_t blockSize = 1 << 20;
+
+// Символьные типы и bool пишутся так же, как это делал operator<<
+template <typename T>
+inline constexpr bool isCharType = std::is_same_v<T, char> || std::is_same_v<T, signed char>
+                                   || std::is_same_v<T, unsigned char>;
+
+template <typename T>
+inline constexpr bool isNumber = std::is_arithmetic_v<T> && !isCharType<T> && !std::is_same_v<T, bool>;
+
+inline auto isSpace(char c) -> bool {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+class Writer {
+ private:
+    std::ofstream file;
+    std::vector<char> buffer;
+    size_t used;
+    uint64_t bytesWritten;
+
+    void reserve(size_t bytes) {
+        if (used + bytes > buffer.size()) {
+            flush();
+        }
+        if (bytes > buffer.size()) {
+            buffer.resize(bytes);
+        }
+    }
+
+ public:
+    explicit Writer(const std::string& filename) : file(filename, std::ios::binary)
+                                                 , buffer(blockSize)
+                                                 , used(0)
+                                                 , bytesWritten(0) {}
+
+    ~Writer() {
+        if (file.is_open()) {
+            flush();
+        }
+    }
+
+    Writer(const Writer&) = delete;
+    auto operator=(const Writer&) -> Writer& = delete;
+
+    [[nodiscard]] auto is_open() const -> bool {
+        return file.is_open();
+    }
+
+    // false, если одна из записей в файл не удалась
+    [[nodiscard]] auto good() const -> bool {
+        return file.good();
+    }
+
+    [[nodiscard]] auto GetBytesWritten() const -> uint64_t {
+        return bytesWritten + used;
+    }
+
+    void put(char c) {
+        reserve(1);
+        buffer[used++] = c;
+    }
+
+    void write(const char* text, size_t length) {
+        reserve(length);
+        memcpy(buffer.data() + used, text, length);
+        used += length;
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            write(value.data(), value.size());
+        } else if constexpr (isCharType<T>) {
+            put(static_cast<char>(value));
+        } else if constexpr (std::is_same_v<T, bool>) {
+            put(value ? '1' : '0');
+        } else if constexpr (isNumber<T>) {
+            // 64 символов хватает для любого целого и кратчайшей записи double
+            reserve(64);
+            auto result = std::to_chars(buffer.data() + used, buffer.data() + buffer.size(), value);
+            used = result.ptr - buffer.data();
+        } else {
+            // Прочие типы форматируются их собственным operator<<
+            std::ostringstream out;
+            out << value;
+            const std::string text = out.str();
+            write(text.data(), text.size());
+        }
+    }
+
+    void flush() {
+        if (used > 0) {
+            file.write(buffer.data(), static_cast<std::streamsize>(used));
+            bytesWritten += used;
+            used = 0;
+        }
+    }
+
+    // Сброс буфера и закрытие файла; false, если какая-либо запись
+    // (например, при нехватке места на диске) или закрытие не удались
+    [[nodiscard]] auto close() -> bool {
+        flush();
+        file.close();
+        return !file.fail();
+    }
+};
+
+class Reader {
+ private:
+    std::ifstream file;
+    std::vector<char> buffer;
+    size_t pos;
+    size_t end;
+    bool eofReached;
+    bool failed;
+    uint64_t bytesRead;
+
+    // Дочитывает следующий блок, сохраняя непрочитанный остаток [pos, end)
+    auto refill() -> bool {
+        if (eofReached) {
+            return false;
+        }
+        if (pos > 0) {
+            memmove(buffer.data(), buffer.data() + pos, end - pos);
+            end -= pos;
+            pos = 0;
+        }
+        if (end == buffer.size()) {
+            buffer.resize(buffer.size() * 2);  // Лексема длиннее блока
+        }
+        file.read(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+        size_t got = static_cast<size_t>(file.gcount());
+        if (got == 0) {
+            eofReached = true;
+        }
+        end += got;
+        bytesRead += got;
+        return got > 0;
+    }
+
+    // Следующая лексема [first, last); false, если данных больше нет
+    auto token(const char*& first, const char*& last) -> bool {
+        while (true) {
+            while (pos < end && isSpace(buffer[pos])) {
+                pos++;
+            }
+            if (pos < end) {
+                break;
+            }
+            if (!refill()) {
+                return false;
+            }
+        }
+        size_t stop = pos;
+        while (true) {
+            while (stop < end && !isSpace(buffer[stop])) {
+                stop++;
+            }
+            if (stop < end || eofReached) {
+                break;
+            }
+            size_t offset = stop - pos;
+            if (!refill()) {
+                stop = end;
+                break;
+            }
+            stop = pos + offset;
+        }
+        first = buffer.data() + pos;
+        last = buffer.data() + stop;
+        pos = stop;
+        return true;
+    }
+
+ public:
+    explicit Reader(const std::string& filename) : file(filename, std::ios::binary)
+                                                 , buffer(blockSize)
+                                                 , pos(0)
+                                                 , end(0)
+                                                 , eofReached(false)
+                                                 , failed(false)
+                                                 , bytesRead(0) {}
+
+    [[nodiscard]] auto is_open() const -> bool {
+        return file.is_open();
+    }
+
+    // true, если очередная лексема не разобралась как значение нужного типа
+    [[nodiscard]] auto fail() const -> bool {
+        return failed;
+    }
+
+    // true при ошибке чтения самого файла
+    [[nodiscard]] auto bad() const -> bool {
+        return file.bad();
+    }
+
+    // true, если файл прочитан до конца
+    [[nodiscard]] auto eof() const -> bool {
+        return eofReached && pos == end;
+    }
+
+    [[nodiscard]] auto GetBytesRead() const -> uint64_t {
+        return bytesRead;
+    }
+
+    // Чтение одного значения; false при конце файла или ошибке формата
+    template <typename T>
+    auto read(T& value) -> bool {
+        if (failed) {
+            return false;
+        }
+        const char* first = nullptr;
+        const char* last = nullptr;
+        if (!token(first, last)) {
+            return false;
+        }
+        if constexpr (std::is_same_v<T, std::string>) {
+            value.assign(first, last);
+        } else if constexpr (isCharType<T>) {
+            // Как и operator>>, символ занимает одну позицию
+            value = static_cast<T>(*first);
+            pos -= (last - first) - 1;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            failed = last - first != 1 || (*first != '0' && *first != '1');
+            value = *first == '1';
+        } else if constexpr (isNumber<T>) {
+            if (*first == '+' && last - first > 1) {
+                first++;
+            }
+            auto result = std::from_chars(first, last, value);
+            failed = result.ec != std::errc() || result.ptr != last;
+        } else {
+            std::istringstream in(std::string(first, last));
+            failed = !(in >> value);
+        }
+        return !failed;
+    }
+
+    void close() {
+        file.close();
+    }
+};
+
+}  // namespace text_codec
+
+#endif  // TEXT_CODEC_HPP
@@ -0,0 +1,359 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <cstdint>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "queue.hpp"
+
+using namespace std;
+
+class TaskGroup;
+
+// Пул потоков с кражей работы. У каждого рабочего потока своя
+// WorkStealingDeque: задачи, порождённые в рабочем потоке, кладутся в его
+// очередь и выполняются им же в порядке LIFO (горячие данные в кэше),
+// а простаивающие потоки крадут самые старые — обычно самые крупные —
+// задачи у случайно выбранных соседей. Задачи из посторонних потоков
+// попадают в общую очередь под мьютексом. Поток, которому нечего делать,
+// недолго крутится и засыпает на futex; новая задача будит одного спящего.
+// Ожидание TaskGroup::wait не блокирует поток: он выполняет чужие задачи,
+// пока его группа не завершится, поэтому вложенный fork/join не взаимоблокируется
+class ThreadPool {
+ public:
+    struct Task {
+        TaskGroup* group;
+
+        explicit Task(TaskGroup* owner) : group(owner) {}
+        virtual ~Task() = default;
+        virtual void run() = 0;
+    };
+
+ private:
+    friend class TaskGroup;
+
+    static constexpr uint32_t spinsBeforeSleep = 64;
+
+    struct Worker {
+        WorkStealingDeque<Task*> deque;
+        thread handle;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+
+    mutex injectLock;
+    Queue<Task*> injected;               // Задачи из потоков вне пула
+    atomic<size_t> injectedCount{0};     // Размер injected для проверки без блокировки
+
+    alignas(64) atomic<uint32_t> wakeEpoch{0};  // Слово futex, на котором спят потоки
+    atomic<uint32_t> sleepers{0};
+    atomic<bool> stopping{false};
+
+    // Рабочий поток, в котором выполняется код (nullptr — поток вне пулов)
+    static inline thread_local ThreadPool* currentPool = nullptr;
+    static inline thread_local size_t currentIndex = 0;
+    static inline thread_local uint64_t stealSeed = 0;
+
+    static void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        this_thread::yield();
+#endif
+    }
+
+    // xorshift для выбора жертвы кражи
+    static auto nextRandom() -> uint64_t {
+        if (stealSeed == 0) {
+            stealSeed = reinterpret_cast<uintptr_t>(&stealSeed) | 1;
+        }
+        stealSeed ^= stealSeed << 13;
+        stealSeed ^= stealSeed >> 7;
+        stealSeed ^= stealSeed << 17;
+        return stealSeed;
+    }
+
+    void submit(Task* task) {
+        if (currentPool == this) {
+            workers[currentIndex]->deque.QPUSH(task);
+        } else {
+            lock_guard<mutex> guard(injectLock);
+            injected.QPUSH(task);
+            injectedCount.fetch_add(1, memory_order_relaxed);
+        }
+        notify();
+    }
+
+    // Будит один спящий поток. Барьер упорядочивает публикацию задачи
+    // и чтение sleepers; спящий делает то же в обратном порядке (sleep),
+    // поэтому либо мы увидим его в sleepers, либо он увидит задачу
+    void notify() {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (sleepers.load(memory_order_relaxed) > 0) {
+            wakeEpoch.fetch_add(1, memory_order_release);
+            futex::wake(wakeEpoch, 1);
+        }
+    }
+
+    // Поиск задачи: своя очередь, общая очередь, кража у соседей
+    auto findTask() -> Task* {
+        Task* task = nullptr;
+        bool isWorker = currentPool == this;
+        if (isWorker && workers[currentIndex]->deque.QPOP(task)) {
+            return task;
+        }
+        if (injectedCount.load(memory_order_relaxed) > 0) {
+            lock_guard<mutex> guard(injectLock);
+            if (injected.GetSize() > 0) {
+                injectedCount.fetch_sub(1, memory_order_relaxed);
+                return injected.QPOP();
+            }
+        }
+        size_t count = workers.size();
+        size_t start = nextRandom() % count;
+        for (size_t k = 0; k < count; k++) {
+            size_t victim = (start + k) % count;
+            if (isWorker && victim == currentIndex) {
+                continue;
+            }
+            if (workers[victim]->deque.QSTEAL(task)) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    auto hasWork() -> bool {
+        if (injectedCount.load(memory_order_relaxed) > 0) {
+            return true;
+        }
+        for (const unique_ptr<Worker>& worker : workers) {
+            if (!worker->deque.empty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void sleep() {
+        uint32_t epoch = wakeEpoch.load(memory_order_acquire);
+        sleepers.fetch_add(1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (!hasWork() && !stopping.load(memory_order_relaxed)) {
+            futex::wait(wakeEpoch, epoch);
+        }
+        sleepers.fetch_sub(1, memory_order_relaxed);
+    }
+
+    void execute(Task* task);
+
+    void workerLoop(size_t index) {
+        currentPool = this;
+        currentIndex = index;
+        uint32_t idle = 0;
+        while (true) {
+            if (Task* task = findTask()) {
+                execute(task);
+                idle = 0;
+            } else if (stopping.load(memory_order_acquire)) {
+                break;
+            } else if (++idle < spinsBeforeSleep) {
+                this_thread::yield();
+            } else {
+                sleep();
+                idle = 0;
+            }
+        }
+        currentPool = nullptr;
+    }
+
+    template <typename F>
+    void splitRange(TaskGroup& group, size_t begin, size_t end, size_t grain, F& body);
+
+ public:
+    // threads == 0 — по числу аппаратных потоков
+    explicit ThreadPool(unsigned threads = 0) {
+        if (threads == 0) {
+            threads = thread::hardware_concurrency();
+        }
+        threads = threads == 0 ? 1 : threads;
+        workers.reserve(threads);
+        for (unsigned i = 0; i < threads; i++) {
+            workers.push_back(make_unique<Worker>());
+        }
+        for (unsigned i = 0; i < threads; i++) {
+            workers[i]->handle = thread([this, i]() { workerLoop(i); });
+        }
+    }
+
+    // Рабочие потоки доделывают оставшиеся задачи и завершаются
+    ~ThreadPool() {
+        stopping.store(true, memory_order_seq_cst);
+        wakeEpoch.fetch_add(1, memory_order_release);
+        futex::wake(wakeEpoch, UINT32_MAX);
+        for (const unique_ptr<Worker>& worker : workers) {
+            worker->handle.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+
+    [[nodiscard]] auto GetThreadCount() const -> size_t {
+        return workers.size();
+    }
+
+    // body(i) для всех i в [begin, end). Диапазон рекурсивно делится пополам
+    // до кусков не длиннее grain (0 — около 8 кусков на поток);
+    // половины забирают простаивающие потоки. Возврат после завершения
+    // всех кусков; первое исключение body пробрасывается
+    template <typename F>
+    void parallel_for(size_t begin, size_t end, F&& body, size_t grain = 0);
+
+    // fork/join: g выполняется параллельно, f — в текущем потоке;
+    // возврат после завершения обеих, затем пробрасывается первое
+    // из исключений f и g
+    template <typename F, typename G>
+    void parallel_invoke(F&& f, G&& g);
+};
+
+// Группа задач для fork/join: spawn порождает задачу, wait ждёт завершения
+// всех порождённых, помогая пулу их выполнять, и пробрасывает первое
+// исключение, выброшенное задачами. Задачи можно порождать из любых
+// потоков, в том числе из самих задач группы
+class TaskGroup {
+ private:
+    friend class ThreadPool;
+
+    template <typename F>
+    struct FunctionTask final : ThreadPool::Task {
+        F function;
+
+        FunctionTask(TaskGroup* owner, F&& f) : ThreadPool::Task(owner), function(std::move(f)) {}
+
+        void run() override {
+            function();
+        }
+    };
+
+    ThreadPool& pool;
+    atomic<size_t> pending{0};
+    atomic<bool> failed{false};
+    exception_ptr error;
+
+    void fail(exception_ptr exception) {
+        if (!failed.exchange(true, memory_order_acq_rel)) {
+            error = std::move(exception);
+        }
+    }
+
+    // Выполнение задач пула, пока не завершатся задачи группы
+    void drain() {
+        uint32_t idle = 0;
+        while (pending.load(memory_order_acquire) > 0) {
+            if (ThreadPool::Task* task = pool.findTask()) {
+                pool.execute(task);
+                idle = 0;
+            } else if (++idle < ThreadPool::spinsBeforeSleep) {
+                ThreadPool::cpuRelax();
+            } else {
+                this_thread::yield();
+            }
+        }
+    }
+
+ public:
+    explicit TaskGroup(ThreadPool& owner) : pool(owner) {}
+
+    // Задачи ссылаются на группу, поэтому она не разрушается раньше них
+    ~TaskGroup() {
+        drain();
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    auto operator=(const TaskGroup&) -> TaskGroup& = delete;
+
+    template <typename F>
+    void spawn(F&& function) {
+        auto* task = new FunctionTask<decay_t<F>>(this, decay_t<F>(std::forward<F>(function)));
+        pending.fetch_add(1, memory_order_relaxed);
+        try {
+            pool.submit(task);
+        } catch (...) {
+            pending.fetch_sub(1, memory_order_relaxed);
+            delete task;
+            throw;
+        }
+    }
+
+    void wait() {
+        drain();
+        if (failed.load(memory_order_acquire)) {
+            failed.store(false, memory_order_relaxed);
+            rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+};
+
+inline void ThreadPool::execute(Task* task) {
+    TaskGroup* group = task->group;
+    try {
+        task->run();
+    } catch (...) {
+        group->fail(current_exception());
+    }
+    delete task;
+    group->pending.fetch_sub(1, memory_order_release);
+}
+
+template <typename F>
+void ThreadPool::splitRange(TaskGroup& group, size_t begin, size_t end, size_t grain, F& body) {
+    while (end - begin > grain) {
+        size_t middle = begin + (end - begin) / 2;
+        group.spawn([this, &group, &body, middle, end, grain]() {
+            splitRange(group, middle, end, grain, body);
+        });
+        end = middle;
+    }
+    for (size_t i = begin; i < end; i++) {
+        body(i);
+    }
+}
+
+template <typename F>
+void ThreadPool::parallel_for(size_t begin, size_t end, F&& body, size_t grain) {
+    if (begin >= end) {
+        return;
+    }
+    if (grain == 0) {
+        grain = max<size_t>(1, (end - begin) / (8 * workers.size()));
+    }
+    TaskGroup group(*this);
+    try {
+        splitRange(group, begin, end, grain, body);
+    } catch (...) {
+        group.fail(current_exception());
+    }
+    group.wait();
+}
+
+template <typename F, typename G>
+void ThreadPool::parallel_invoke(F&& f, G&& g) {
+    TaskGroup group(*this);
+    group.spawn([&g]() { g(); });
+    // Исключение f не должно пропустить wait: g ещё может выполняться,
+    // и её исключение тоже нужно учесть. Пробрасывается первое из них
+    try {
+        f();
+    } catch (...) {
+        group.fail(current_exception());
+    }
+    group.wait();
+}
+
+#endif  // THREAD_POOL_HPP